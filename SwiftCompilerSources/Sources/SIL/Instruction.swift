@@ -18,6 +18,15 @@ import SILBridging
 //===----------------------------------------------------------------------===//
 
 public class Instruction : ListNode, CustomStringConvertible, Hashable {
+  // Note on bridging granularity: list traversal is the only place where we
+  // pay one bridging call per instruction, and that is inherent to SIL's
+  // intrusive linked lists. Bulk accesses already cross the bridge once and
+  // then stay on the Swift side: `operands`, block successors and v-/witness-
+  // table entries come back as a single BridgedArrayRef (pointer + count) and
+  // are indexed with plain pointer arithmetic (see OperandArray). Snapshotting
+  // a block's instructions into a contiguous descriptor buffer would not help
+  // beyond that: passes mutate the list while walking it, so any such
+  // snapshot would be invalidated as soon as it is useful.
   final public var next: Instruction? {
     SILInstruction_next(bridged).instruction
   }
@@ -409,6 +409,9 @@ function (swift_benchmark_compile_archopts)
       "-F" "${sdk}/../../../Developer/Library/Frameworks"
       "-I" "${srcdir}/utils/LibProc"
       "-no-link-objc-runtime")
+  else()
+    list(APPEND common_options_driver
+      "-I" "${srcdir}/utils/LinuxPerf")
   endif()
   set(bench_library_objects)
   set(bench_library_sibfiles)
@@ -58,6 +58,15 @@ class Yield(namedtuple("Yield", "before_sample after")):
     """
 
 
+class Counters(namedtuple("Counters", "instructions branch_misses cache_misses")):
+    u"""Hardware counter deltas measured over a single sample.
+
+    `instructions` retired, `branch_misses` and `cache_misses`, all averaged
+    per iteration. Reported by the test driver in verbose mode on platforms
+    where the PMU is readable.
+    """
+
+
 class PerformanceTestSamples(object):
     """Collection of runtime samples from the benchmark execution.
 
@@ -299,6 +308,7 @@ class PerformanceTestResult(object):
             [int(x) for x in csv_row[-3:]] if meta else (None, None, None)
         )
         self.yields = None
+        self.counters = None
         self.setup = None
 
     def __repr__(self):
@@ -394,6 +404,7 @@ class LogParser(object):
         self.samples, self.yields, self.num_iters = [], [], 1
         self.setup, self.max_rss, self.mem_pages = None, None, None
         self.voluntary_cs, self.involuntary_cs = None, None
+        self.counters = []
 
     # Parse lines like this
     # #,TEST,SAMPLES,MIN(μs),MAX(μs),MEAN(μs),SD(μs),MEDIAN(μs)
@@ -422,6 +433,7 @@ class LogParser(object):
             r.samples.exclude_outliers()
         self.results.append(r)
         r.yields = self.yields or None
+        r.counters = self.counters or None
         self._reset()
 
     def _store_memory_stats(self, max_rss, mem_pages):
@@ -455,6 +467,12 @@ class LogParser(object):
                 Yield(len(self.samples), int(since_last_yield))
             )
         ),
+        # Hardware counters per iteration: instructions, branch/cache misses
+        re.compile(r"\s+Counters (\d+),(\d+),(\d+)"): (
+            lambda self, instructions, branches, caches: self.counters.append(
+                Counters(int(instructions), int(branches), int(caches))
+            )
+        ),
         re.compile(r"( *#[, \t]+TEST[, \t]+SAMPLES[, \t].*)"): _configure_format,
         # Environmental statistics: memory usage and context switches
         re.compile(
@@ -692,6 +692,23 @@ Totals,2"""
         self.assertEqual(yielded.after, 369918)
         self.assertEqual(r.yields, [(1, 369918), (2, 381039)])
 
+    def test_parse_counters_verbose(self):
+        """Parse per-sample hardware counters in verbose mode."""
+        verbose_log = """    Sample 0,11812
+    Counters 90210,37,11
+    Sample 1,11467
+    Counters 90198,41,13
+2,AngryPhonebook,2,11467,11812,11640,244,11640
+"""
+        parser = LogParser()
+        results = parser.parse_results(verbose_log.split("\n"))
+
+        r = results[0]
+        self.assertEqual(r.counters, [(90210, 37, 11), (90198, 41, 13)])
+        self.assertEqual(r.counters[0].instructions, 90210)
+        self.assertEqual(r.counters[1].branch_misses, 41)
+        self.assertEqual(r.counters[1].cache_misses, 13)
+
     def test_parse_environment_verbose(self):
         """Parse stats about environment in verbose mode."""
         verbose_log = """    MAX_RSS 8937472 - 8904704 = 32768 (8 pages)
@@ -12,6 +12,7 @@
 
 #if os(Linux)
 import Glibc
+import LinuxPerf
 #elseif os(Windows)
 import MSVCRT
 #else
@@ -421,10 +422,28 @@ final class TestRunner {
   }
 
 #if os(Linux)
+  /// File descriptors of freely running per-process hardware counters, or -1
+  /// when the PMU is unavailable (e.g. a restrictive perf_event_paranoid
+  /// setting, or a virtualized environment without PMU access).
+  static let hardwareCounters = (
+    instructions: swift_perf_open_instructions(),
+    branchMisses: swift_perf_open_branch_misses(),
+    cacheMisses: swift_perf_open_cache_misses())
+
+  static func readHardwareCounters()
+    -> (instructions: UInt64, branchMisses: UInt64, cacheMisses: UInt64) {
+    return (
+      instructions: swift_perf_read_counter(hardwareCounters.instructions),
+      branchMisses: swift_perf_read_counter(hardwareCounters.branchMisses),
+      cacheMisses: swift_perf_read_counter(hardwareCounters.cacheMisses))
+  }
+
+  /// Deltas of the hardware counters over the last sample, per iteration.
+  var lastSampleCounters:
+    (instructions: UInt64, branchMisses: UInt64, cacheMisses: UInt64)?
+
   private static func getExecutedInstructions() -> UInt64 {
-    // FIXME: there is a Linux PMC API you can use to get this, but it's
-    // not quite so straightforward.
-    return 0
+    return swift_perf_read_counter(hardwareCounters.instructions)
   }
 #else
   private static func getExecutedInstructions() -> UInt64 {
@@ -533,11 +552,32 @@ final class TestRunner {
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
     name.withCString { p in startTrackingObjects(p) }
 #endif
+#if os(Linux)
+    // Read the counters outside of the measured interval, so that the reads
+    // don't pollute the timing; the counter deltas absorb the measurement
+    // bookkeeping instead, which is noise orders of magnitude below a sample.
+    let startCounters = TestRunner.readHardwareCounters()
+#endif
 
     startMeasurement()
     fn(numIters)
     stopMeasurement()
 
+#if os(Linux)
+    let endCounters = TestRunner.readHardwareCounters()
+    if endCounters.instructions >= startCounters.instructions {
+      let n = UInt64(numIters)
+      lastSampleCounters = (
+        instructions: (endCounters.instructions - startCounters.instructions)
+          / n,
+        branchMisses: (endCounters.branchMisses - startCounters.branchMisses)
+          / n,
+        cacheMisses: (endCounters.cacheMisses - startCounters.cacheMisses) / n)
+    } else {
+      lastSampleCounters = nil
+    }
+#endif
+
 #if SWIFT_RUNTIME_ENABLE_LEAK_CHECKER
     name.withCString { p in stopTrackingObjects(p) }
 #endif
@@ -564,6 +604,15 @@ final class TestRunner {
 
     func addSample(_ time: Int) {
       logVerbose("    Sample \(samples.count),\(time)")
+#if os(Linux)
+      // Report the per-iteration hardware counters alongside the sample, when
+      // the PMU was readable. Instruction counts are far less sensitive to
+      // scheduling noise than wall time, so they are worth gating on.
+      if let counters = lastSampleCounters, counters.instructions > 0 {
+        logVerbose("    Counters \(counters.instructions)," +
+          "\(counters.branchMisses),\(counters.cacheMisses)")
+      }
+#endif
       samples.append(time)
     }
 
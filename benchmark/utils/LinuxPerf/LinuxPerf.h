@@ -0,0 +1,60 @@
+//===--- LinuxPerf.h ------------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+// This file wraps the perf_event_open system call, which has no glibc wrapper,
+// so that the benchmark harness can read hardware counters on Linux.
+
+#if defined(__linux__)
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static inline int _swift_perf_event_open(unsigned long long config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Count this process on any CPU, starting immediately.
+  return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+// Each of these returns a file descriptor of a freely running counter for the
+// calling process, or -1 when the PMU is unavailable (e.g. a restrictive
+// perf_event_paranoid setting, or a virtualized environment without PMU
+// access).
+
+static inline int swift_perf_open_instructions(void) {
+  return _swift_perf_event_open(PERF_COUNT_HW_INSTRUCTIONS);
+}
+
+static inline int swift_perf_open_branch_misses(void) {
+  return _swift_perf_event_open(PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+static inline int swift_perf_open_cache_misses(void) {
+  return _swift_perf_event_open(PERF_COUNT_HW_CACHE_MISSES);
+}
+
+/// Returns the current value of the counter, or 0 when it can't be read.
+static inline unsigned long long swift_perf_read_counter(int fd) {
+  unsigned long long value = 0;
+  if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value))
+    return 0;
+  return value;
+}
+
+#endif // defined(__linux__)
@@ -385,6 +385,14 @@ swiftscan_scanner_cache_load(swiftscan_scanner_t scanner,
 SWIFTSCAN_PUBLIC void
 swiftscan_scanner_cache_reset(swiftscan_scanner_t scanner);
 
+/// For the specified \c scanner instance, evict cached dependency information
+/// that no recent scanning query has used (e.g. modules that ceased to exist
+/// after a branch switch), while keeping recently-used entries warm. Unlike
+/// \c swiftscan_scanner_cache_reset , subsequent queries still benefit from
+/// the surviving cache contents. Must not be called concurrently with a scan.
+SWIFTSCAN_PUBLIC void
+swiftscan_scanner_cache_garbage_collect(swiftscan_scanner_t scanner);
+
 /// An entry point to invoke the compiler via a library call.
 SWIFTSCAN_PUBLIC int invoke_swift_compiler(int argc, const char **argv);
 
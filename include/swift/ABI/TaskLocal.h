@@ -185,6 +185,38 @@ public:
     /// (after the body has completed).
     TaskLocal::Item *head = nullptr;
 
+    /// Number of slots in the lookup cache; must be a power of two.
+    static const uintptr_t lookupCacheSlots = 4;
+
+    /// A lazily allocated, direct-mapped cache of recently looked-up items,
+    /// indexed by key. Repeated `getValue` calls for the same key become O(1)
+    /// instead of walking the item chain, which may reach through many parent
+    /// tasks.
+    ///
+    /// Cached item pointers remain valid for as long as they are reachable
+    /// from this task's chain: items are immutable once published, and the
+    /// only mutations visible to this task are its own push/pop operations,
+    /// which invalidate the affected slot. The cache is only ever accessed by
+    /// the owning task, exactly like `head`, so no synchronization is needed.
+    ///
+    /// The cache is heap allocated (rather than task allocated) because it
+    /// must live until `destroy`, which would violate the stack discipline
+    /// of the task allocator.
+    TaskLocal::Item **lookupCache = nullptr;
+
+    /// Index of the cache slot used for the given key.
+    static uintptr_t lookupCacheSlot(const HeapObject *key) {
+      return (reinterpret_cast<uintptr_t>(key) >> 4) & (lookupCacheSlots - 1);
+    }
+
+    /// Forget any cached lookup result for the given key, e.g. because a
+    /// binding for it was pushed or popped.
+    void invalidateLookupCache(const HeapObject *key) {
+      if (lookupCache) {
+        lookupCache[lookupCacheSlot(key)] = nullptr;
+      }
+    }
+
   public:
 
     void initializeLinkParent(AsyncTask *task, AsyncTask *parent);
@@ -27,6 +27,7 @@
 #include "swift/AST/Type.h"
 #include "swift/AST/TypeAlignments.h"
 #include "swift/AST/Types.h"
+#include "swift/Basic/Fingerprint.h"
 #include "swift/Basic/LangOptions.h"
 #include "swift/Basic/Located.h"
 #include "swift/Basic/Malloc.h"
@@ -499,11 +500,30 @@ public:
   /// Set a new stats reporter.
   void setStatsReporter(UnifiedStatsReporter *stats);
 
+  /// Record that an expression with the given fingerprint is about to be
+  /// constraint-solved.
+  ///
+  /// \returns \c true if an expression with the same fingerprint has already
+  /// been solved during this frontend invocation.
+  bool recordSolvedExprFingerprint(Fingerprint fingerprint);
+
 public:
   /// getIdentifier - Return the uniqued and AST-Context-owned version of the
   /// specified string.
   Identifier getIdentifier(StringRef Str) const;
 
+  /// Retrieve the cached mangled name for the given declaration and
+  /// mangler-specific discriminator, or an empty string if none has been
+  /// recorded. See \c Mangle::ASTMangler::mangleEntity().
+  StringRef getCachedMangledName(const Decl *decl, unsigned discriminator) const;
+
+  /// Record the mangled name for the given declaration and mangler-specific
+  /// discriminator, copying the string into the permanent arena.
+  ///
+  /// \returns the arena-owned copy (or a previously recorded one).
+  StringRef cacheMangledName(const Decl *decl, unsigned discriminator,
+                             StringRef mangledName) const;
+
   /// Convert a given alias map to a map of Identifiers between module aliases and their actual names.
   /// For example, if '-module-alias Foo=X -module-alias Bar=Y' input is passed in, the aliases Foo and Bar are
   /// the names of the imported or referenced modules in source files in the main module, and X and Y
@@ -144,6 +144,20 @@ protected:
       && (!CanSymbolicReference || CanSymbolicReference(referent));
   }
 
+  /// Whether every mangling option above still has its default value.
+  ///
+  /// Manglings that are keyed only by a declaration may be cached in the
+  /// ASTContext in this configuration only, since every one of these
+  /// options (and a caller-provided module) can change the output.
+  bool isDefaultManglerConfiguration() const {
+    return !Mod && OptimizeProtocolNames && !UseObjCRuntimeNames &&
+           !DWARFMangling && !AllowNamelessEntities &&
+           !AllowSymbolicReferences && AllowStandardSubstitutions &&
+           AllowConcurrencyStandardSubstitutions && AllowMarkerProtocols &&
+           !Preconcurrency && RespectOriginallyDefinedIn &&
+           !CanSymbolicReference && UsePunycode && UseSubstitutions;
+  }
+
   std::vector<std::pair<SymbolicReferent, unsigned>> SymbolicReferences;
   
 public:
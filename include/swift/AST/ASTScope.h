@@ -119,6 +119,16 @@ SourceLoc extractNearestSourceLoc(std::tuple<ASTScopeImpl *, ScopeCreator *>);
 /// \code
 /// -dump-scope-maps expanded
 /// \endcode
+///
+/// Note on memory: scope nodes are expanded lazily but are never torn down
+/// again; once a function body's subtree exists it persists for the life of
+/// the ASTContext. Unlinking a subtree would not return its memory either,
+/// because the nodes (and their child vectors) live in the context's
+/// bump-pointer arena. Making subtrees releasable and re-expandable would
+/// require a dedicated allocator for the scope tree and a way to invalidate
+/// the insertion points and parent pointers cached by in-flight expansions,
+/// so for now the tree's footprint is only measured (NumASTScopes) rather
+/// than reclaimed.
 class ASTScopeImpl : public ASTAllocated<ASTScopeImpl> {
   friend class NodeAdder;
   friend class Portion;
@@ -588,6 +588,74 @@ protected:
   virtual void anchor();
 };
 
+/// An ASTWalker that drives several client walkers over a single shared
+/// traversal, dispatching each node to every client that is still interested
+/// in it.
+///
+/// Passes that walk the same function body back-to-back spend most of their
+/// time re-doing the pointer chasing of the traversal itself rather than
+/// per-node work. Registering the walkers with a MultiplexingASTWalker and
+/// performing one walk visits each node once while still delivering the same
+/// pre- and post-visitation callbacks to every client.
+///
+/// Clients must be observers: a client may skip the subtree of the node it is
+/// handed or stop participating in the walk, but it must always return the
+/// node it was given unchanged, since splicing a replacement into a tree that
+/// other clients are concurrently visiting cannot be reconciled. Clients must
+/// also be compatible with the default traversal shape; the multiplexer
+/// leaves every shouldWalk* policy at its default answer, so a walker that
+/// overrides one of those hooks needs its own walk.
+///
+/// A client that returns \c Action::SkipChildren stops receiving callbacks
+/// until the walk leaves the corresponding subtree. A client that returns
+/// \c Action::Stop is dropped for the remainder of the walk; the shared
+/// traversal itself only terminates early once every client has dropped out.
+class MultiplexingASTWalker : public ASTWalker {
+  struct Client {
+    /// The client walker, or null once the client has requested a stop.
+    ASTWalker *Walker;
+
+    /// While the client is skipping a subtree, the depth of the node whose
+    /// children it asked to skip; None while the client is receiving
+    /// callbacks.
+    Optional<unsigned> SkipDepth;
+  };
+
+  SmallVector<Client, 4> Clients;
+
+  /// The number of nodes between the root of the walk and the node currently
+  /// being visited.
+  unsigned Depth = 0;
+
+  /// The number of clients that have not yet requested a stop.
+  unsigned NumActive;
+
+  PreWalkAction::Kind
+  dispatchPre(function_ref<PreWalkAction::Kind(ASTWalker &)> visit);
+  PostWalkAction::Kind
+  dispatchPost(function_ref<PostWalkAction::Kind(ASTWalker &)> visit);
+
+public:
+  explicit MultiplexingASTWalker(ArrayRef<ASTWalker *> walkers);
+
+  PreWalkResult<Expr *> walkToExprPre(Expr *E) override;
+  PostWalkResult<Expr *> walkToExprPost(Expr *E) override;
+  PreWalkResult<Stmt *> walkToStmtPre(Stmt *S) override;
+  PostWalkResult<Stmt *> walkToStmtPost(Stmt *S) override;
+  PreWalkResult<Pattern *> walkToPatternPre(Pattern *P) override;
+  PostWalkResult<Pattern *> walkToPatternPost(Pattern *P) override;
+  PreWalkAction walkToDeclPre(Decl *D) override;
+  PostWalkAction walkToDeclPost(Decl *D) override;
+  PreWalkAction walkToTypeReprPre(TypeRepr *T) override;
+  PostWalkAction walkToTypeReprPost(TypeRepr *T) override;
+  PreWalkAction walkToParameterListPre(ParameterList *PL) override;
+  PostWalkAction walkToParameterListPost(ParameterList *PL) override;
+  PreWalkResult<ArgumentList *>
+  walkToArgumentListPre(ArgumentList *ArgList) override;
+  PostWalkResult<ArgumentList *>
+  walkToArgumentListPost(ArgumentList *ArgList) override;
+};
+
 } // end namespace swift
 
 #endif
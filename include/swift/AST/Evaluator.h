@@ -318,6 +318,20 @@ public:
   /// caching.
   void clearCache() { cache.clear(); }
 
+  /// Clear the cached results of all requests in the given zone, e.g. to
+  /// bound memory by releasing a phase's results once the phase completes.
+  /// See the caveats on evaluator::RequestCache::clearZone().
+  ///
+  /// Note that this does not clear the caches of requests that use external
+  /// caching.
+  void clearCacheForZone(Zone zone) { cache.clearZone(zone); }
+
+  /// Estimate the memory used by the evaluator's internal request cache,
+  /// not counting storage owned by the cached values themselves.
+  size_t estimateCacheMemoryUsage() const {
+    return cache.estimateMemoryUsage();
+  }
+
   /// Is the given request, or an equivalent, currently being evaluated?
   template <typename Request>
   bool hasActiveRequest(const Request &request) const {
@@ -403,6 +403,10 @@ public:
 
   unsigned WitnessMethodElimination : 1;
 
+  /// Run LLVM hot/cold splitting, outlining provably cold regions (such as
+  /// unreachable-terminated error paths) into functions in a cold section.
+  unsigned EnableHotColdSplit : 1;
+
   unsigned ConditionalRuntimeRecords : 1;
 
   unsigned InternalizeAtLink : 1;
@@ -485,7 +489,8 @@ public:
         DisableConcreteTypeMetadataMangledNameAccessors(false),
         DisableStandardSubstitutionsInReflectionMangling(false),
         EnableGlobalISel(false), VirtualFunctionElimination(false),
-        WitnessMethodElimination(false), ConditionalRuntimeRecords(false),
+        WitnessMethodElimination(false), EnableHotColdSplit(false),
+        ConditionalRuntimeRecords(false),
         InternalizeAtLink(false), InternalizeSymbols(false),
         EmitGenericRODatas(false), NoPreallocatedInstantiationCaches(false),
         DisableReadonlyStaticObjects(false), CmdArgs(),
@@ -500,6 +500,13 @@ class GlobalModuleDependenciesCache {
     /// which correspond to instances of the same module that may have been found
     /// in different sets of search paths.
     ModuleDependenciesKindMap ModuleDependenciesMap;
+
+    /// The scan generation in which each cached module was last recorded or
+    /// returned from a lookup, keyed the same way as \c ModuleDependenciesMap.
+    /// Consulted by \c garbageCollect to evict modules no recent scan has
+    /// touched (e.g. modules that ceased to exist after a branch switch).
+    std::unordered_map<ModuleDependenciesKind, llvm::StringMap<uint64_t>,
+                       ModuleDependenciesKindHash> LastUsedGenerationMap;
   };
 
   /// The 'persistent' Clang dependency scanner service
@@ -519,6 +526,10 @@ class GlobalModuleDependenciesCache {
   /// The current target triple cache configuration
   Optional<std::string> CurrentTriple;
 
+  /// Monotonically-increasing count of scanning actions that have used this
+  /// cache, advanced by each \c ModuleDependenciesCache wrapping it.
+  uint64_t CurrentScanGeneration = 1;
+
   /// The triples used by scanners using this cache, in the order in which they were used
   std::vector<std::string> AllTriples;
 
@@ -529,6 +540,13 @@ class GlobalModuleDependenciesCache {
   const llvm::StringMap<ModuleDependenciesVector> &
   getDependenciesMap(ModuleDependenciesKind kind) const;
 
+  /// Stamp the given cached module as used in the current scan generation.
+  void markUsed(ModuleDependenciesKind kind, StringRef moduleName) const;
+
+  /// Enter a new scan generation. Invoked by the constructor of
+  /// \c ModuleDependenciesCache, once per scanning action.
+  void advanceScanGeneration() { ++CurrentScanGeneration; }
+
 public:
   GlobalModuleDependenciesCache();
   GlobalModuleDependenciesCache(const GlobalModuleDependenciesCache &) = delete;
@@ -542,6 +560,13 @@ public:
     return AllTriples;
   }
 
+  /// Evict cached modules that no scanning action has recorded or looked up
+  /// within the last \p keepGenerations scan generations, e.g. modules that
+  /// ceased to exist after a branch switch. Must not be called while a
+  /// scanning action (a live \c ModuleDependenciesCache) is using this cache,
+  /// since eviction invalidates the references such actions hold.
+  void garbageCollect(uint64_t keepGenerations = 10);
+
 private:
   /// Enforce clients not being allowed to query this cache directly, it must be
   /// wrapped in an instance of `ModuleDependenciesCache`.
@@ -224,6 +224,35 @@ public:
   void shiftDownResults();
 };
 
+/// A cache of the results of unqualified operator lookups performed within
+/// a single source file.
+///
+/// Operator functions can only be declared at file scope or as members of a
+/// type, so the candidate set for an operator name is fully determined by
+/// the name and the innermost type context of the lookup (if any). That
+/// makes a result safe to reuse for every other occurrence of the same
+/// operator in the same context, avoiding a scope walk per operator
+/// expression.
+class OperatorLookupCache {
+  llvm::DenseMap<std::pair<DeclName, const DeclContext *>, LookupResult>
+      Cache;
+
+public:
+  /// Retrieve the cached result for the given operator name and innermost
+  /// type context, or \c nullptr if it hasn't been recorded yet.
+  const LookupResult *lookup(DeclName name,
+                             const DeclContext *typeContext) const {
+    auto known = Cache.find({name, typeContext});
+    return known == Cache.end() ? nullptr : &known->second;
+  }
+
+  /// Record the result of an operator lookup.
+  void record(DeclName name, const DeclContext *typeContext,
+              const LookupResult &result) {
+    Cache.insert({{name, typeContext}, result});
+  }
+};
+
 enum class UnqualifiedLookupFlags {
   /// This lookup should only return types.
   TypeLookup            = 1 << 0,
@@ -711,7 +711,7 @@ SourceLoc extractNearestSourceLoc(const LookupConformanceDescriptor &desc);
 class LookupConformanceInModuleRequest
     : public SimpleRequest<LookupConformanceInModuleRequest,
                            ProtocolConformanceRef(LookupConformanceDescriptor),
-                           RequestFlags::Uncached|RequestFlags::DependencySink> {
+                           RequestFlags::Cached|RequestFlags::DependencySink> {
 public:
   using SimpleRequest::SimpleRequest;
 
@@ -723,6 +723,17 @@ private:
       Evaluator &evaluator, LookupConformanceDescriptor desc) const;
 
 public:
+  // Caching. The constraint solver checks the same concrete conformances
+  // over and over (e.g. `Int: Equatable` for every use of `==`), so cache
+  // the result whenever the key type is guaranteed to outlive the cache.
+  // Types mentioning type variables or placeholders live in the constraint
+  // checker's arena and their pointers are recycled between solves, so
+  // those lookups are answered from scratch each time.
+  bool isCached() const {
+    Type ty = std::get<0>(getStorage()).Ty;
+    return !ty->hasTypeVariable() && !ty->hasPlaceholder();
+  }
+
   // Incremental dependencies
   void writeDependencySink(evaluator::DependencyCollector &tracker,
                            ProtocolConformanceRef result) const;
@@ -162,14 +162,20 @@ public:
 class PerRequestCache {
   void *Storage;
   std::function<void(void *)> Deleter;
+  std::function<size_t(void *)> MemoryEstimator;
 
-  PerRequestCache(void *storage, std::function<void(void *)> deleter)
-      : Storage(storage), Deleter(deleter) {}
+  PerRequestCache(void *storage, std::function<void(void *)> deleter,
+                  std::function<size_t(void *)> memoryEstimator)
+      : Storage(storage), Deleter(deleter),
+        MemoryEstimator(memoryEstimator) {}
 
 public:
-  PerRequestCache() : Storage(nullptr), Deleter([](void *) {}) {}
+  PerRequestCache()
+      : Storage(nullptr), Deleter([](void *) {}),
+        MemoryEstimator([](void *) -> size_t { return 0; }) {}
   PerRequestCache(PerRequestCache &&other)
-      : Storage(other.Storage), Deleter(std::move(other.Deleter)) {
+      : Storage(other.Storage), Deleter(std::move(other.Deleter)),
+        MemoryEstimator(std::move(other.MemoryEstimator)) {
     other.Storage = nullptr;
   }
 
@@ -189,8 +195,9 @@ public:
     using Map =
         llvm::DenseMap<RequestKey<Request>,
                        typename Request::OutputType>;
-    return PerRequestCache(new Map(),
-                           [](void *ptr) { delete static_cast<Map *>(ptr); });
+    return PerRequestCache(
+        new Map(), [](void *ptr) { delete static_cast<Map *>(ptr); },
+        [](void *ptr) { return static_cast<Map *>(ptr)->getMemorySize(); });
   }
 
   template <typename Request>
@@ -205,6 +212,14 @@ public:
   }
 
   bool isNull() const { return !Storage; }
+
+  /// Estimate the memory used by the underlying map's table. Does not
+  /// account for storage owned by the cached values themselves, so this
+  /// is a lower bound.
+  size_t estimateMemoryUsage() const {
+    return Storage ? MemoryEstimator(Storage) : 0;
+  }
+
   ~PerRequestCache() {
     if (Storage)
       Deleter(Storage);
@@ -278,6 +293,35 @@ public:
 #include "swift/Basic/TypeIDZones.def"
 #undef SWIFT_TYPEID_ZONE
   }
+
+  /// Drop all cached results for requests in the given zone, e.g. to
+  /// release a phase's zone-local results once that phase has completed.
+  /// Subsequent requests in the zone recompute from scratch, so callers
+  /// must be sure the dropped results are either dead or safely (and
+  /// cheaply enough) recomputable, including any diagnostics they emit.
+  void clearZone(Zone zone) {
+    switch (zone) {
+#define SWIFT_TYPEID_ZONE(Name, Id)                                            \
+    case Zone::Name:                                                           \
+      Name##ZoneCache.clear();                                                 \
+      return;
+#include "swift/Basic/TypeIDZones.def"
+#undef SWIFT_TYPEID_ZONE
+    }
+    llvm_unreachable("unknown type ID zone");
+  }
+
+  /// Estimate the memory used by all per-request maps. A lower bound;
+  /// storage owned by cached values is not counted.
+  size_t estimateMemoryUsage() const {
+    size_t result = 0;
+#define SWIFT_TYPEID_ZONE(Name, Id)                                            \
+    for (const auto &perRequestCache : Name##ZoneCache)                        \
+      result += perRequestCache.estimateMemoryUsage();
+#include "swift/Basic/TypeIDZones.def"
+#undef SWIFT_TYPEID_ZONE
+    return result;
+  }
 };
 
 /// Type-erased wrapper for caching dependencies from a single type of request.
@@ -23,6 +23,7 @@
 
 namespace swift {
 
+class OperatorLookupCache;
 class PersistentParserState;
 
 /// Kind of import affecting how a decl can be reexported.
@@ -88,6 +89,16 @@ public:
     /// Whether to suppress warnings when parsing. This is set for secondary
     /// files, as they get parsed multiple times.
     SuppressWarnings = 1 << 5,
+
+    /// Whether to record the bodies of functions that can never be needed
+    /// by another file as skipped, rather than delayed.
+    ///
+    /// A delayed body is re-lexed and parsed on demand; a skipped body is
+    /// recorded as a byte range only and never materialized. This is only
+    /// set in configurations that skip typechecking of those same bodies
+    /// (see \c FunctionBodySkipping), where the typechecker would otherwise
+    /// mark them as skipped after the fact.
+    SkipNonInlinableFunctionBodies = 1 << 6,
   };
   using ParsingOptions = OptionSet<ParsingFlags>;
 
@@ -98,6 +109,10 @@ private:
   std::unique_ptr<SourceLookupCache> Cache;
   SourceLookupCache &getCache() const;
 
+  /// A cache of unqualified operator lookups performed in this file, created
+  /// lazily on the first operator lookup.
+  std::unique_ptr<OperatorLookupCache> OperatorLookups;
+
   /// This is the list of modules that are imported by this module.
   ///
   /// This is \c None until it is filled in by the import resolution phase.
@@ -240,6 +255,10 @@ public:
   /// code for it. Note this method returns \c false in WMO.
   bool isPrimary() const { return IsPrimary; }
 
+  /// Retrieve the cache of unqualified operator lookups performed in this
+  /// file, creating it if necessary.
+  OperatorLookupCache &getOperatorLookupCache();
+
   /// A cache of syntax nodes that can be reused when creating the syntax tree
   /// for this file.
   swift::SyntaxParsingCache *SyntaxParsingCache = nullptr;
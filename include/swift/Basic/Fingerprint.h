@@ -14,6 +14,7 @@
 #define SWIFT_BASIC_FINGERPRINT_H
 
 #include "swift/Basic/StableHasher.h"
+#include "llvm/ADT/DenseMapInfo.h"
 #include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/SmallString.h"
@@ -140,6 +141,22 @@ template <> struct StableHasher::Combiner<Fingerprint> {
 namespace llvm {
 class raw_ostream;
 raw_ostream &operator<<(raw_ostream &OS, const swift::Fingerprint &fp);
+
+template <> struct DenseMapInfo<swift::Fingerprint> {
+  static inline swift::Fingerprint getEmptyKey() {
+    return swift::Fingerprint{swift::Fingerprint::Core{~0ULL, ~0ULL}};
+  }
+  static inline swift::Fingerprint getTombstoneKey() {
+    return swift::Fingerprint{swift::Fingerprint::Core{~0ULL, ~0ULL - 1ULL}};
+  }
+  static unsigned getHashValue(const swift::Fingerprint &fp) {
+    return static_cast<unsigned>(hash_value(fp));
+  }
+  static bool isEqual(const swift::Fingerprint &lhs,
+                      const swift::Fingerprint &rhs) {
+    return lhs == rhs;
+  }
+};
 } // namespace llvm
 
 #endif // SWIFT_BASIC_FINGERPRINT_H
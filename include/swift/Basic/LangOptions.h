@@ -813,6 +813,12 @@ namespace swift {
     /// and completly bypass the Clang driver.
     bool DirectClangCC1ModuleBuild = false;
 
+    /// When set, Clang instances created in this process attach to one shared
+    /// in-memory PCM cache, so a module file validated by one compilation is
+    /// not re-read and re-validated by the next. Only safe when compilations
+    /// run sequentially in the process; set by frontend reuse, not a flag.
+    bool UseSharedInMemoryModuleCache = false;
+
     /// Return a hash code of any components from these options that should
     /// contribute to a Swift Bridging PCH hash.
     llvm::hash_code getPCHHashComponents() const {
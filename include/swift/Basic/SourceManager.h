@@ -18,11 +18,55 @@
 #include "clang/Basic/FileManager.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Chrono.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/Mutex.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
+#include <memory>
 
 namespace swift {
 
+/// A process-lifetime cache of read-only, memory-mapped source file buffers
+/// that can be shared by several SourceManagers.
+///
+/// When multiple compilations run in one process (see
+/// \c FrontendOptions::ReuseFrontendForMultipleCompilations), every job
+/// re-reads the same files from disk. This cache maps each file once and
+/// hands out references to the same mapping, together with an MD5 checksum
+/// of the contents computed when the file was first mapped.
+///
+/// A cached mapping is revalidated against the file's current size and
+/// modification time before reuse and remapped if either changed, the same
+/// staleness tradeoff mtime-based incremental builds already make. All
+/// operations are thread-safe.
+class SharedSourceBufferCache {
+  struct Entry {
+    std::shared_ptr<llvm::MemoryBuffer> Buffer;
+    llvm::MD5::MD5Result Checksum;
+    uint64_t Size;
+    llvm::sys::TimePoint<> ModTime;
+  };
+
+  mutable llvm::sys::Mutex Mutex;
+  llvm::StringMap<Entry> Entries;
+
+public:
+  /// Returns the buffer for \p Path, mapping the file and recording its
+  /// checksum if no valid cached mapping exists. The returned buffer is
+  /// null-terminated and must not be mutated.
+  llvm::ErrorOr<std::shared_ptr<llvm::MemoryBuffer>>
+  getOrOpen(llvm::vfs::FileSystem &FS, StringRef Path);
+
+  /// Returns the checksum recorded for \p Path's contents, or None if the
+  /// file has not been mapped by this cache.
+  Optional<llvm::MD5::MD5Result> getChecksum(StringRef Path) const;
+
+  /// The cache shared by all compiler instances in this process.
+  static SharedSourceBufferCache &getProcessCache();
+};
+
 /// This class manages and owns source buffers.
 class SourceManager {
 public:
@@ -63,6 +107,14 @@ private:
   std::map<const char *, VirtualFile> VirtualFiles;
   mutable std::pair<const char *, const VirtualFile*> CachedVFile = {nullptr, nullptr};
 
+  /// If non-null, a cache of shared file mappings consulted before reading
+  /// source files from disk.
+  SharedSourceBufferCache *SharedBufferCache = nullptr;
+
+  /// Keeps the mappings behind buffers added with \c addSharedSourceBuffer()
+  /// alive for the lifetime of this SourceManager.
+  std::vector<std::shared_ptr<llvm::MemoryBuffer>> SharedBufferOwners;
+
   Optional<unsigned> findBufferContainingLocInternal(SourceLoc Loc) const;
 public:
   SourceManager(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> FS =
@@ -157,9 +209,34 @@ public:
   /// Whether the source location is pointing to any buffer owned by the SourceManager.
   bool isOwning(SourceLoc Loc) const;
 
+  /// Install \p Cache to be consulted before source files are read from
+  /// disk, so that compilations sharing the process also share one mapping
+  /// per file.
+  void setSharedBufferCache(SharedSourceBufferCache *Cache) {
+    SharedBufferCache = Cache;
+  }
+
+  SharedSourceBufferCache *getSharedBufferCache() const {
+    return SharedBufferCache;
+  }
+
   /// Adds a memory buffer to the SourceManager, taking ownership of it.
   unsigned addNewSourceBuffer(std::unique_ptr<llvm::MemoryBuffer> Buffer);
 
+  /// Creates a zero-copy view of \p Buffer, retaining a reference so the
+  /// underlying mapping outlives this SourceManager's use of it. The view
+  /// preserves the buffer's identifier.
+  std::unique_ptr<llvm::MemoryBuffer>
+  createViewOfSharedBuffer(std::shared_ptr<llvm::MemoryBuffer> Buffer);
+
+  /// Adds a zero-copy view of the shared buffer \p Buffer, as with
+  /// \c addNewSourceBuffer() but without taking ownership of the contents.
+  unsigned addSharedSourceBuffer(std::shared_ptr<llvm::MemoryBuffer> Buffer);
+
+  /// Returns the content checksum for \p BufferID if its contents came from
+  /// the installed shared buffer cache, or None otherwise.
+  Optional<llvm::MD5::MD5Result> getChecksumForBuffer(unsigned BufferID) const;
+
   /// Add a \c #sourceLocation-defined virtual file region of \p Length.
   void createVirtualFile(SourceLoc Loc, StringRef Name, int LineOffset,
                          unsigned Length);
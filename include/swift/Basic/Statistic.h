@@ -148,6 +148,7 @@ private:
   long maxChildRSS = 0;
   SmallString<128> StatsFilename;
   SmallString<128> TraceFilename;
+  SmallString<128> TraceEventsFilename;
   SmallString<128> ProfileDirname;
   llvm::TimeRecord StartedTime;
   std::thread::id MainThreadID;
@@ -337,6 +337,25 @@ bool isObjCSymbol(llvm::StringRef mangledName);
 /// \param mangledName A null-terminated string containing a mangled name.
 bool isOldFunctionTypeMangling(llvm::StringRef mangledName);
 
+/// Attempts to extract the module name and the base entity name from a
+/// mangled symbol in a single forward pass, without building a demangling
+/// node tree.
+///
+/// This handles the common flat shapes produced for module-scope and
+/// nominal-type-scope entities in the stable mangling (e.g. functions,
+/// variables, accessors and nominal type names). It is deliberately
+/// conservative: any symbol using substitutions, punycode, private
+/// discriminated contexts or other structure it cannot prove is the base
+/// name makes it return false, and the caller must fall back to the full
+/// demangler.
+///
+/// On success, \p moduleName and \p baseName point into \p mangledName,
+/// except that the standard library module is returned as the literal
+/// "Swift".
+bool tryExtractModuleAndBaseName(llvm::StringRef mangledName,
+                                 llvm::StringRef &moduleName,
+                                 llvm::StringRef &baseName);
+
 class Demangler;
 
 /// The demangler context.
@@ -52,6 +52,19 @@ llvm::ErrorOr<swiftscan_string_ref_t> getTargetInfo(ArrayRef<const char *> Comma
 
 /// The high-level implementation of the dependency scanner that runs on
 /// an individual worker thread.
+///
+/// This class is the long-lived warm scanner: a libSwiftScan client creates
+/// one instance, holds it for the duration of a build, and every query served
+/// from the same instance reuses \c SharedCache instead of re-reading
+/// interfaces and module maps. Serving queries over a socket is the client's
+/// business (the driver hosts the scanner in-process today); nothing in this
+/// class requires process-per-scan.
+///
+/// Caveat for long-lived use: cache entries are not revalidated against the
+/// filesystem. The scanner records no stat or hash information at scan time,
+/// so a client that knows inputs changed between queries must call
+/// \c resetCache. Per-entry revalidation would need timestamps captured
+/// during the scan and carried through the cache serialization format.
 class DependencyScanningTool {
 public:
   /// Construct a dependency scanning tool.
@@ -90,6 +103,10 @@ public:
   bool loadCache(llvm::StringRef path);
   /// Discard the tool's current `SharedCache` and start anew.
   void resetCache();
+  /// Evict `SharedCache` entries that no recent scan has used, e.g. modules
+  /// that ceased to exist after a branch switch, while keeping the rest of
+  /// the cache warm. Must not be called concurrently with a scan.
+  void garbageCollectCache();
   
   const std::vector<DependencyScannerDiagnosticCollectingConsumer::ScannerDiagnosticInfo>& getDiagnostics() const { return CDC.Diagnostics; }
   /// Discared the collection of diagnostics encountered so far.
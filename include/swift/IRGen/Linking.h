@@ -1596,12 +1596,12 @@ public:
     if (Triple.isOSBinFormatCOFF() && !Triple.isOSCygMing())
       GV->setDLLStorageClass(IRL.DLLStorage);
 
-    // TODO: BFD and gold do not handle COMDATs properly
-    if (Triple.isOSBinFormatELF())
-      return;
-
     // COMDATs cannot be applied to declarations.  If we have a definition,
-    // apply the COMDAT.
+    // apply the COMDAT.  This also covers ELF: without a COMDAT group each
+    // statically linked object keeps its own copy of every linkonce_odr
+    // body (e.g. outlined copy/destroy helpers) in .text, and only the
+    // symbol is coalesced.  The historic BFD/gold bugs with COMDAT groups
+    // have long been fixed in the binutils versions we support.
     if (definition)
       if (IRL.Linkage == llvm::GlobalValue::LinkOnceODRLinkage ||
           IRL.Linkage == llvm::GlobalValue::WeakODRLinkage)
@@ -420,6 +420,13 @@ private:
                      TypeRefID::Hash, TypeRefID::Equal> AssociatedTypeCache;
 
   /// Cache for field info lookups.
+  ///
+  /// Populated lazily, one reflection section at a time, as lookups miss
+  /// (see populateFieldTypeInfoCacheWithReflectionAtIndex); once a section
+  /// has been scanned its descriptors resolve by hash here and the section
+  /// is never walked again. TypeRefs themselves are interned through the
+  /// per-kind TypeRefID maps below (FIND_OR_CREATE_TYPEREF), and an
+  /// ExternalTypeRefCache can persist descriptor locations across runs.
   std::unordered_map<std::string, RemoteRef<FieldDescriptor>> FieldTypeInfoCache;
 
   std::vector<std::unique_ptr<const GenericSignatureRef>> SignatureRefPool;
@@ -35,6 +35,17 @@ namespace remote {
 ///
 /// This abstraction presents memory as if it were a read-only
 /// representation of the address space of a remote process.
+///
+/// Deliberately no caching or read-ahead happens at this layer. The library
+/// cannot see the remote process's lifecycle -- there is no "target resumed"
+/// event in MemoryReaderInterface, so a page cache here could not be
+/// invalidated and would serve stale memory after a stop/resume cycle. The
+/// debugger hosting the reader callback is the one party that both observes
+/// resumes and already owns a process memory cache, which is where
+/// coalescing small reads belongs; implementations of readBytes are expected
+/// to be backed by it. Batch-read entry points would likewise have to be
+/// grown in the C interface first, since existing out-of-tree readers only
+/// implement the callbacks declared there.
 class MemoryReader {
 public:
   /// A convenient name for the return type from readBytes.
@@ -257,6 +257,18 @@ const void * const _swift_debug_allocationPoolPointer;
 SWIFT_RUNTIME_STDLIB_SPI
 std::atomic<const void *> _swift_debug_metadataAllocationBacktraceList;
 
+/// Returns the number of pool pages the metadata allocator has allocated from
+/// the system so far, not counting the statically-allocated initial pool.
+/// Multiply by the pool page size (currently 16K) to attribute arena RSS.
+SWIFT_RUNTIME_STDLIB_SPI
+uint64_t _swift_debug_getMetadataAllocatorPageCount();
+
+/// Returns the cumulative number of bytes the metadata allocator has handed
+/// out for the given tag from MetadataAllocatorTags.def, or 0 for an unknown
+/// tag.  Unlike allocation iteration, this accounting is always on.
+SWIFT_RUNTIME_STDLIB_SPI
+uint64_t _swift_debug_getMetadataAllocatorTagBytes(uint16_t tag);
+
 SWIFT_RUNTIME_STDLIB_SPI
 const void * const _swift_debug_protocolConformanceStatePointer;
 
@@ -183,6 +183,16 @@ void swift_nonatomic_release(HeapObject *object);
 SWIFT_RUNTIME_EXPORT
 void swift_release_n(HeapObject *object, uint32_t n);
 
+/// Release each object in a buffer of (possibly null, possibly repeated)
+/// object pointers, as if by calling swift_release on each element in order.
+/// Bulk destroys of homogeneous reference containers can call this once
+/// instead of making one runtime call per element. Each element still takes
+/// its own atomic decrement; decrements on distinct objects cannot be fused,
+/// and the per-object release/acquire discipline in RefCount.h is already
+/// the minimal fencing for a correct deinit handoff.
+SWIFT_RUNTIME_EXPORT
+void swift_release_many(HeapObject *const *objects, size_t count);
+
 /// Sets the RC_DEALLOCATING_FLAG flag. This is done non-atomically.
 /// The strong reference count of \p object must be 1 and no other thread may
 /// retain the object during executing this function.
@@ -859,6 +859,11 @@ getSuperclassMetadata(MetadataRequest request, const ClassMetadata *self);
 void verifyMangledNameRoundtrip(const Metadata *metadata);
 #endif
 
+/// Append the mangled name of a newly instantiated metadata record to the
+/// file named by SWIFT_DEBUG_METADATA_INSTANTIATION_LOG. Does nothing unless
+/// that variable is set.
+void recordMetadataInstantiation(const Metadata *metadata);
+
 SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_API
 const TypeContextDescriptor *swift_getTypeContextDescriptor(const Metadata *type);
 
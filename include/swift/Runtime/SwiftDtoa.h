@@ -250,6 +250,14 @@ size_t swift_dtoa_optimal_float(float, char *dest, size_t length);
 
 #if SWIFT_DTOA_BINARY64_SUPPORT
 size_t swift_dtoa_optimal_binary64_p(const void *, char *dest, size_t length);
+// Format a contiguous array of `count` binary64 values into `dest` as
+// consecutive NUL-terminated strings, stopping when the next value no
+// longer fits.  Returns the number of values formatted; `*usedLength`
+// (if non-NULL) receives the total bytes written including terminators.
+// One call replaces `count` calls for bulk serialization of numeric data.
+size_t swift_dtoa_optimal_binary64_batch(const void *values, size_t count,
+                                         char *dest, size_t length,
+                                         size_t *usedLength);
 #if DOUBLE_IS_BINARY64
 // If `double` happens to be binary64, define the convenience wrapper.
 size_t swift_dtoa_optimal_double(double, char *dest, size_t length);
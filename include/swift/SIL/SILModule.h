@@ -955,6 +955,11 @@ public:
     return static_cast<T *>(allocate(sizeof(T) * Count, alignof(T)));
   }
 
+  /// Returns the number of bytes the module's bump allocator has handed out
+  /// so far. This only grows, which makes it usable as a memory high-water
+  /// mark for per-pass statistics.
+  size_t getBytesAllocated() const { return BPA.getBytesAllocated(); }
+
   /// Allocates a slab of memory.
   ///
   /// This has (almost) zero cost, because for the first time, the allocation is
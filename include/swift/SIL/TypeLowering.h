@@ -784,6 +784,13 @@ class TypeConverter {
   llvm::SetVector<CanType> AggregateFieldsBeingLowered;
   
   /// Mapping for types independent on contextual generic parameters.
+  ///
+  /// A single unsynchronized map is sufficient: every query funnels through
+  /// the one frontend thread. Even multi-threaded IRGen (-num-threads) emits
+  /// all Swift IR -- and thus all type lowering -- serially on the main
+  /// thread before handing finished llvm::Modules to the LLVM codegen
+  /// threads, so sharding or locking this cache would add overhead with no
+  /// concurrency to serve.
   llvm::DenseMap<CachingTypeKey, const TypeLowering *> LoweredTypes;
 
   llvm::DenseMap<std::pair<TypeExpansionContext, SILDeclRef>, SILConstantInfo *>
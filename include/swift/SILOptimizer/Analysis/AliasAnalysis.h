@@ -72,17 +72,25 @@ private:
 
   using ScopeCacheKey = std::pair<SILInstruction *, SILInstruction *>;
 
-  using TBAACacheKey = std::pair<SILType, SILType>;
+public:
+  /// The TBAA relation only depends on the two types and the context in
+  /// which they are expanded, so it can be cached across functions and
+  /// across invalidations.
+  using TBAACacheKey =
+      std::pair<std::pair<SILType, SILType>, TypeExpansionContext>;
 
+private:
   SideEffectAnalysis *SEA;
   EscapeAnalysis *EA;
 
   /// A cache for the computation of TBAA. True means that the types may
   /// alias. False means that the types must not alias.
   ///
-  /// We don't need to invalidate this cache because type aliasing relations
-  /// never change.
-  llvm::DenseMap<TBAACacheKey, bool> TypesMayAliasCache;
+  /// This cache is owned by the AliasAnalysisContainer and shared between
+  /// all per-function AliasAnalysis instances: type aliasing relations
+  /// never change, so there is no need to recompute them after a function
+  /// is invalidated.
+  llvm::DenseMap<TBAACacheKey, bool> &TypesMayAliasCache;
 
   /// AliasAnalysis value cache.
   ///
@@ -125,8 +133,9 @@ private:
   bool isInImmutableScope(SILInstruction *inst, SILValue V);
 
 public:
-  AliasAnalysis(SideEffectAnalysis *SEA, EscapeAnalysis *EA)
-    : SEA(SEA), EA(EA) {}
+  AliasAnalysis(SideEffectAnalysis *SEA, EscapeAnalysis *EA,
+                llvm::DenseMap<TBAACacheKey, bool> &TypesMayAliasCache)
+      : SEA(SEA), EA(EA), TypesMayAliasCache(TypesMayAliasCache) {}
 
   static SILAnalysisKind getAnalysisKind() { return SILAnalysisKind::Alias; }
 
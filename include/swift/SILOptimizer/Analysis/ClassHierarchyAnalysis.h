@@ -34,7 +34,9 @@ public:
 
   ClassHierarchyAnalysis(SILModule *Mod)
       : SILAnalysis(SILAnalysisKind::ClassHierarchy), M(Mod) {
-    init();
+    // The subclass caches are computed lazily on the first query: all
+    // analyses are constructed up front by the pass manager, and not every
+    // pipeline ends up asking class hierarchy questions.
   }
 
   ~ClassHierarchyAnalysis();
@@ -65,6 +67,7 @@ public:
   /// Returns a list of the known direct subclasses of a class \p C in
   /// the current module.
   const ClassList &getDirectSubClasses(ClassDecl *C) {
+    populateCachesIfNecessary();
     return DirectSubclassesCache[C];
   }
 
@@ -81,6 +84,7 @@ public:
 
   /// Returns true if the class is inherited by another class in this module.
   bool hasKnownDirectSubclasses(ClassDecl *C) {
+    populateCachesIfNecessary();
     return DirectSubclassesCache.count(C);
   }
 
@@ -94,11 +98,24 @@ public:
 private:
   /// Compute inheritance properties.
   void init();
+
+  /// Populate the subclass caches on the first query.
+  void populateCachesIfNecessary() {
+    if (CachesPopulated)
+      return;
+    init();
+    CachesPopulated = true;
+  }
+
   void getIndirectSubClasses(ClassDecl *Base,
                              ClassList &IndirectSubs);
   /// The module
   SILModule *M;
 
+  /// True once the subclass caches have been populated from the module's
+  /// vtables.
+  bool CachesPopulated = false;
+
   /// A cache that maps a class to all of its known direct subclasses.
   llvm::DenseMap<ClassDecl*, ClassList> DirectSubclassesCache;
 
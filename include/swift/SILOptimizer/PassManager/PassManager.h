@@ -18,6 +18,7 @@
 #include "swift/SILOptimizer/PassManager/PassPipeline.h"
 #include "swift/SILOptimizer/PassManager/Passes.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/Chrono.h"
@@ -198,6 +199,19 @@ class SILPassManager {
   /// Set to true when a pass invalidates an analysis.
   bool CurrentPassHasInvalidated = false;
 
+  /// The functions the current pass reported as invalidated, collected from
+  /// the per-function invalidation notifications. Only meaningful while
+  /// \p CurrentPassInvalidationIsComplete is true; cleared before each pass.
+  /// Used to restrict post-module-pass verification to the functions that
+  /// actually changed (-sil-verify-incremental).
+  llvm::SmallPtrSet<SILFunction *, 16> FunctionsInvalidatedByCurrentPass;
+
+  /// False if the current pass issued a module-wide invalidation (all
+  /// analyses or the function tables), in which case
+  /// \p FunctionsInvalidatedByCurrentPass does not cover everything that
+  /// changed.
+  bool CurrentPassInvalidationIsComplete = true;
+
   /// True if we need to stop running passes and restart again on the
   /// same function.
   bool RestartPipeline = false;
@@ -216,6 +230,46 @@ class SILPassManager {
 
   std::chrono::nanoseconds totalPassRuntime = std::chrono::nanoseconds(0);
 
+  /// Aggregated runtime and change counts for one kind of pass.
+  ///
+  /// Only collected if the -sil-print-pass-summary option is specified. The
+  /// summaries are printed when the pass manager is destructed.
+  struct PassRunSummary {
+    StringRef tag;
+    std::chrono::nanoseconds runtime = std::chrono::nanoseconds(0);
+    unsigned numRuns = 0;
+    unsigned numRunsWithChanges = 0;
+  };
+
+  /// The collected summaries, indexed by PassKind. Multiple pipeline entries
+  /// of the same pass aggregate into a single summary.
+  llvm::DenseMap<unsigned, PassRunSummary> passSummaries;
+
+  /// Record the outcome of a single pass run for -sil-print-pass-summary.
+  void recordPassSummary(SILTransform *T, std::chrono::nanoseconds duration,
+                         bool changedSomething);
+
+  /// Statistics of a single pass run, recorded for -sil-pass-stats-json.
+  struct PassRunStats {
+    StringRef tag;
+    std::string function; // empty for module passes
+    std::chrono::nanoseconds runtime;
+    int instructionDelta;
+    /// Bytes handed out by the module's bump allocator after the run; this
+    /// only grows, so it serves as the memory high-water mark.
+    size_t allocatedBytes;
+  };
+
+  /// The recorded pass runs, in execution order.
+  ///
+  /// Only collected if the -sil-pass-stats-json option is specified.
+  std::vector<PassRunStats> passRunStats;
+
+  /// Record the statistics of a single pass run for -sil-pass-stats-json.
+  void recordPassRunStats(SILTransform *T, SILFunction *F,
+                          std::chrono::nanoseconds duration,
+                          int instructionDelta);
+
   /// C'tor. It creates and registers all analysis passes, which are defined
   /// in Analysis.def. This is private as it should only be used by
   /// ExecuteSILPipelineRequest.
@@ -269,6 +323,7 @@ public:
         AP->invalidate();
 
     CurrentPassHasInvalidated = true;
+    CurrentPassInvalidationIsComplete = false;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -292,6 +347,7 @@ public:
     for (auto AP : Analyses) {
       AP->notifyAddedOrModifiedFunction(F);
     }
+    FunctionsInvalidatedByCurrentPass.insert(F);
   }
 
   /// Broadcast the invalidation of the function to all analysis.
@@ -301,8 +357,9 @@ public:
     for (auto AP : Analyses)
       if (!AP->isLocked())
         AP->invalidate(F, K);
-    
+
     CurrentPassHasInvalidated = true;
+    FunctionsInvalidatedByCurrentPass.insert(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -316,6 +373,9 @@ public:
         AP->invalidateFunctionTables();
 
     CurrentPassHasInvalidated = true;
+    // Table changes are not attributable to single functions; fall back to
+    // whole-module verification.
+    CurrentPassInvalidationIsComplete = false;
 
     // Assume that all functions have changed. Clear all masks of all functions.
     CompletedPassesMap.clear();
@@ -329,6 +389,8 @@ public:
         AP->notifyWillDeleteFunction(F);
 
     CurrentPassHasInvalidated = true;
+    // The function is about to go away; make sure we don't try to verify it.
+    FunctionsInvalidatedByCurrentPass.erase(F);
     // Any change let all passes run again.
     CompletedPassesMap[F].reset();
   }
@@ -2816,6 +2816,12 @@ private:
   /// Do not set directly, call \c recordFailedConstraint instead.
   Constraint *failedConstraint = nullptr;
 
+  /// The source range of the disjunction whose choices have been attempted
+  /// the most while solving, together with its running count of attempts.
+  /// When the solver gives up because an expression is too complex, this
+  /// identifies the subexpression that consumed the budget.
+  std::pair<SourceRange, unsigned> CostliestDisjunction{SourceRange(), 0};
+
   /// Current phase of the constraint system lifetime.
   ConstraintSystemPhase Phase = ConstraintSystemPhase::ConstraintGeneration;
 
@@ -3117,7 +3123,16 @@ private:
     ConstraintSystem &CS;
 
     FreeTypeVariableBinding AllowFreeTypeVariables;
-    
+
+    /// Arena for constraints generated along the current solver path.
+    ///
+    /// Everything allocated here is dead once the solve completes - the
+    /// solutions only capture type bindings, overload choices, and fixes -
+    /// so the whole arena is released in one shot by the destructor
+    /// instead of having abandoned disjunction branches accumulate in the
+    /// constraint system's own allocator for its entire lifetime.
+    llvm::BumpPtrAllocator Allocator;
+
     /// Return current depth of solution stack for debug printing.
     unsigned int getCurrentIndent() const { return depth * 2; }
 
@@ -3131,6 +3146,11 @@ private:
     /// processing this constraint system.
     SavedTypeVariableBindings savedBindings;
 
+    /// The number of choices attempted for each disjunction along all
+    /// solver paths, used to attribute "too complex" failures to the
+    /// subexpression that consumed the budget.
+    llvm::SmallDenseMap<ConstraintLocator *, unsigned> DisjunctionChoiceCounts;
+
      /// The best solution computed so far.
     Optional<Score> BestScore;
 
@@ -5022,6 +5042,28 @@ public:
   /// Retrieve the allocator used by this constraint system.
   llvm::BumpPtrAllocator &getAllocator() { return Allocator; }
 
+  /// Note that a choice of the disjunction with the given locator is about
+  /// to be attempted, updating the record of which disjunction has consumed
+  /// the most of the solver's budget.
+  void recordDisjunctionChoiceAttempt(ConstraintLocator *locator) {
+    assert(solverState);
+    auto count = ++solverState->DisjunctionChoiceCounts[locator];
+    if (count > CostliestDisjunction.second) {
+      auto range = locator->getAnchor().getSourceRange();
+      if (range.isValid())
+        CostliestDisjunction = {range, count};
+    }
+  }
+
+  /// Retrieve the allocator to use for a newly created constraint.
+  ///
+  /// While a solve is active, constraints are placed in the solver state's
+  /// per-solve arena so that memory churned through failed disjunction
+  /// branches is reclaimed in bulk when the solve completes.
+  llvm::BumpPtrAllocator &getConstraintAllocator() {
+    return solverState ? solverState->Allocator : Allocator;
+  }
+
   template <typename It>
   ArrayRef<typename std::iterator_traits<It>::value_type>
   allocateCopy(It start, It end) {
@@ -5881,12 +5923,15 @@ private:
   ///
   /// \param cs The constraint system.
   /// \param solutions All of the solutions to the system.
-  /// \param diff The differences among the solutions.
+  /// \param getDiff Returns the differences among the solutions. Called
+  /// lazily, since comparisons decided by the score vector alone never need
+  /// the diff to be materialized.
   /// \param idx1 The index of the first solution.
   /// \param idx2 The index of the second solution.
   static SolutionCompareResult
   compareSolutions(ConstraintSystem &cs, ArrayRef<Solution> solutions,
-                   const SolutionDiff &diff, unsigned idx1, unsigned idx2);
+                   llvm::function_ref<const SolutionDiff &()> getDiff,
+                   unsigned idx1, unsigned idx2);
 
 public:
   /// Increase the score of the given kind for the current (partial) solution
@@ -29,7 +29,7 @@
 
 /// Minor version changes when new APIs are added in ABI- and source-compatible
 /// way.
-#define SWIFT_DEMANGLE_VERSION_MINOR 2
+#define SWIFT_DEMANGLE_VERSION_MINOR 3
 
 /// @}
 
@@ -46,6 +46,28 @@ SWIFT_DEMANGLE_LINKAGE
 size_t swift_demangle_getDemangledName(const char *MangledName,
                                        char *OutputBuffer, size_t Length);
 
+/// Demangle a batch of Swift symbols, sharing demangler state across the
+/// whole batch.
+///
+/// Inputs are length-delimited and need not be '\0'-terminated:
+/// \p MangledNames and \p MangledNameLengths are parallel arrays of
+/// \p NumMangledNames entries. The demangled results are written into
+/// \p OutputBuffer back to back, each '\0'-terminated; an input that is not a
+/// Swift-mangled name is copied through unchanged. Entries that do not fit in
+/// the output buffer are truncated (but still '\0'-terminated) or dropped.
+///
+/// This is the preferred interface for symbolication pipelines: the internal
+/// demangler arena is recycled between symbols instead of being rebuilt for
+/// every call.
+///
+/// \returns the total number of bytes required to hold all results including
+/// their terminators, even if greater than \p Length.
+SWIFT_DEMANGLE_LINKAGE
+size_t swift_demangle_getDemangledNames(const char *const *MangledNames,
+                                        const size_t *MangledNameLengths,
+                                        size_t NumMangledNames,
+                                        char *OutputBuffer, size_t Length);
+
 /// Demangle Swift function names with module names and implicit self
 /// and metatype type names in function signatures stripped.
 ///
@@ -31,6 +31,11 @@
 // node retains the syntax arena. Should a RawSyntaxNode A reference a node B
 // from a different arena, it automatically adds B's arena as a child arena of
 // A's arena, thereby keeping B's arena alive as long as A's arena is alive.
+//
+// Consequently, individual RawSyntax nodes carry no reference count at all:
+// they are plain bump-allocated objects whose lifetime is that of their arena,
+// and the only retain/release traffic for a parse-only tree (as served by
+// libSwiftSyntaxParser) is on the arena itself - once per tree, not per node.
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_SYNTAX_RAWSYNTAX_H
@@ -70,6 +70,14 @@ llvm::Optional<stack_bounds> thread_get_current_stack_bounds();
 
 // .. Mutex support ..........................................................
 
+// A 4-byte futex-based lock with an inline uncontended path already exists in
+// Linux/ulock.h, and once_t below uses it. Mutex deliberately stays on
+// pthread_mutex_t anyway: the ulock uses the priority-inheritance futex
+// protocol (the runtime must not invert priorities the way an unfair
+// os_unfair_lock-alike without PI can), and FUTEX_LOCK_PI measures slower
+// than glibc's adaptive mutex under contention on x86-64 -- see the header
+// comment in ulock.h. What the ulock buys is its 4-byte size, which is why
+// it backs once_t; it is not a faster general mutex here.
 using mutex_handle = ::pthread_mutex_t;
 
 inline void mutex_init(mutex_handle &handle, bool checked = false) {
@@ -623,15 +623,20 @@ static StringRef getKeyContent(SDKContext &Ctx, KeyKind Kind) {
 
 SDKNode* SDKNode::constructSDKNode(SDKContext &Ctx,
                                    llvm::yaml::MappingNode *Node) {
-  static auto GetScalarString = [&](llvm::yaml::Node *N) -> StringRef {
+  auto GetScalarString = [&](llvm::yaml::Node *N) -> StringRef {
     SmallString<64> Buffer;
     return Ctx.buffer(cast<llvm::yaml::ScalarNode>(N)->getValue(Buffer));
   };
 
-  static auto getAsInt = [&](llvm::yaml::Node *N) -> int {
-    return std::stoi(cast<llvm::yaml::ScalarNode>(N)->getRawValue().str());
+  auto getAsInt = [&](llvm::yaml::Node *N) -> int {
+    int Value = 0;
+    bool Failed = cast<llvm::yaml::ScalarNode>(N)->getRawValue()
+        .getAsInteger(10, Value);
+    assert(!Failed && "expected an integer scalar");
+    (void)Failed;
+    return Value;
   };
-  static auto getAsBool = [&](llvm::yaml::Node *N) -> bool {
+  auto getAsBool = [&](llvm::yaml::Node *N) -> bool {
     auto txt = cast<llvm::yaml::ScalarNode>(N)->getRawValue();
     assert(txt.startswith("false") || txt.startswith("true"));
     return txt.startswith("true");
@@ -2265,6 +2270,16 @@ struct ArrayTraits<ArrayRef<StringRef>> {
 
 namespace  {// Anonymous namespace.
 // Deserialize an SDKNode tree.
+//
+// The dump stays JSON on purpose: baseline dumps are checked into source
+// trees (test/api-digester, the platform ABI baselines) and consumed by
+// external tooling, so a compact binary format would orphan every existing
+// baseline for a one-time parse saving. String interning already happens on
+// the in-memory side via SDKContext::buffer. Diffing the two trees afterwards
+// also stays single-threaded: the diff passes funnel through shared mutable
+// SDKContext state (the interned-string allocator, UpdateMap, diagnostics),
+// so top-level subtrees cannot be compared on separate threads without
+// restructuring all of that state.
 std::pair<std::unique_ptr<llvm::MemoryBuffer>, SDKNode*>
 static parseJsonEmit(SDKContext &Ctx, StringRef FileName) {
   namespace yaml = llvm::yaml;
@@ -167,6 +167,11 @@ struct ASTContext::Implementation {
   /// The set of cleanups to be called when the ASTContext is destroyed.
   std::vector<std::function<void(void)>> Cleanups;
 
+  /// The fingerprints of expressions that have been constraint-solved during
+  /// this frontend invocation, used to account for repeated solves of
+  /// structurally identical expressions.
+  llvm::DenseSet<Fingerprint> SolvedExprFingerprints;
+
   /// The set of top-level modules we have loaded.
   /// This map is used for iteration, therefore it's a MapVector and not a
   /// DenseMap.
@@ -174,9 +179,21 @@ struct ASTContext::Implementation {
 
   // FIXME: This is a StringMap rather than a StringSet because StringSet
   // doesn't allow passing in a pre-existing allocator.
+  //
+  // Note that this table is deliberately unsynchronized: an ASTContext and
+  // everything it allocates are confined to a single thread, and in-process
+  // parallelism (multiple CompilerInstances, the dependency scanner) gives
+  // each worker its own context. Interning therefore scales by confinement;
+  // do not add locking here, and do not share Identifiers across contexts.
   llvm::StringMap<Identifier::Aligner, llvm::BumpPtrAllocator&>
   IdentifierTable;
 
+  /// Cached mangled names for declarations, keyed by the declaration and a
+  /// mangler-specific discriminator. The strings are owned by the permanent
+  /// arena. See \c Mangle::ASTMangler::mangleEntity().
+  llvm::DenseMap<std::pair<const Decl *, unsigned>, StringRef>
+  MangledNameCache;
+
   /// The declaration of Swift.AssignmentPrecedence.
   PrecedenceGroupDecl *AssignmentPrecedence = nullptr;
 
@@ -733,6 +750,10 @@ RC<syntax::SyntaxArena> ASTContext::getSyntaxArena() const {
   return getImpl().TheSyntaxArena;
 }
 
+bool ASTContext::recordSolvedExprFingerprint(Fingerprint fingerprint) {
+  return !getImpl().SolvedExprFingerprints.insert(fingerprint).second;
+}
+
 /// getIdentifier - Return the uniqued and AST-Context-owned version of the
 /// specified string.
 Identifier ASTContext::getIdentifier(StringRef Str) const {
@@ -745,6 +766,19 @@ Identifier ASTContext::getIdentifier(StringRef Str) const {
   return Identifier(I->getKeyData());
 }
 
+StringRef ASTContext::getCachedMangledName(const Decl *decl,
+                                           unsigned discriminator) const {
+  return getImpl().MangledNameCache.lookup({decl, discriminator});
+}
+
+StringRef ASTContext::cacheMangledName(const Decl *decl, unsigned discriminator,
+                                       StringRef mangledName) const {
+  auto &entry = getImpl().MangledNameCache[{decl, discriminator}];
+  if (entry.empty())
+    entry = AllocateCopy(mangledName);
+  return entry;
+}
+
 void ASTContext::lookupInModule(
     ModuleDecl *M,
     StringRef name,
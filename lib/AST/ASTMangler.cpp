@@ -88,10 +88,25 @@ std::string ASTMangler::mangleClosureEntity(const AbstractClosureExpr *closure,
 }
 
 std::string ASTMangler::mangleEntity(const ValueDecl *decl, SymbolKind SKind) {
+  // The same declaration is mangled over and over again across SILGen,
+  // IRGen, TBDGen and serialization. Consult the per-context cache, but
+  // only when no option that could change the output has been adjusted.
+  bool canCache = isDefaultManglerConfiguration();
+  ASTContext &ctx = decl->getASTContext();
+  if (canCache) {
+    StringRef cached =
+        ctx.getCachedMangledName(decl, static_cast<unsigned>(SKind));
+    if (!cached.empty())
+      return cached.str();
+  }
+
   beginMangling();
   appendEntity(decl);
   appendSymbolKind(SKind);
-  return finalize();
+  std::string result = finalize();
+  if (canCache)
+    ctx.cacheMangledName(decl, static_cast<unsigned>(SKind), result);
+  return result;
 }
 
 std::string ASTMangler::mangleDestructorEntity(const DestructorDecl *decl,
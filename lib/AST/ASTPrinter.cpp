@@ -758,7 +758,9 @@ class PrintAST : public ASTVisitor<PrintAST> {
 
   void printType(Type T) { printTypeWithOptions(T, Options); }
 
-  void printTransformedTypeWithOptions(Type T, PrintOptions options) {
+  void printTransformedTypeWithOptions(Type T, const PrintOptions &options) {
+    // Copying PrintOptions is expensive (it owns vectors and functions), so
+    // only do so on the transforming path below, which needs to modify them.
     if (CurrentType && Current && CurrentType->mayHaveMembers()) {
       auto *M = Current->getDeclContext()->getParentModule();
       SubstitutionMap subMap;
@@ -780,7 +782,10 @@ class PrintAST : public ASTVisitor<PrintAST> {
 
       T = T.subst(subMap, SubstFlags::DesugarMemberTypes);
 
-      options.TransformContext = TypeTransformContext(CurrentType);
+      PrintOptions transformOptions = options;
+      transformOptions.TransformContext = TypeTransformContext(CurrentType);
+      printTypeWithOptions(T, transformOptions);
+      return;
     }
 
     printTypeWithOptions(T, options);
@@ -810,6 +815,11 @@ class PrintAST : public ASTVisitor<PrintAST> {
   void printTypeLoc(const TypeLoc &TL) { printTypeLocWithOptions(TL, Options); }
 
   void printTypeLocForImplicitlyUnwrappedOptional(TypeLoc TL, bool IUO) {
+    // The common case doesn't change the option, so don't pay for a copy
+    // of the options just to pass the same flag value along.
+    if (IUO == Options.PrintOptionalAsImplicitlyUnwrapped)
+      return printTypeLocWithOptions(TL, Options);
+
     PrintOptions options = Options;
     options.PrintOptionalAsImplicitlyUnwrapped = IUO;
     printTypeLocWithOptions(TL, options);
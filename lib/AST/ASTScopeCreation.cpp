@@ -600,6 +600,9 @@ void ASTScopeImpl::addChild(ASTScopeImpl *child, ASTContext &ctx) {
     ctx.addDestructorCleanup(storedChildren);
 
   storedChildren.push_back(child);
+
+  if (auto *s = ctx.Stats)
+    ++s->getFrontendCounters().NumASTScopes;
 }
 
 #pragma mark implementations of expansion
@@ -2080,3 +2080,243 @@ bool GenericParamList::walk(ASTWalker &walker) {
 ArgumentList *ArgumentList::walk(ASTWalker &walker) {
   return Traversal(walker).doIt(this);
 }
+
+//===----------------------------------------------------------------------===//
+//                           MultiplexingASTWalker
+//===----------------------------------------------------------------------===//
+
+MultiplexingASTWalker::MultiplexingASTWalker(ArrayRef<ASTWalker *> walkers) {
+  assert(!walkers.empty() && "multiplexing zero walkers");
+  for (auto *walker : walkers)
+    Clients.push_back({walker, None});
+  NumActive = Clients.size();
+}
+
+ASTWalker::PreWalkAction::Kind MultiplexingASTWalker::dispatchPre(
+    function_ref<PreWalkAction::Kind(ASTWalker &)> visit) {
+  bool anyWalking = false;
+  for (auto &client : Clients) {
+    if (!client.Walker)
+      continue;
+
+    // A pre-visit at a depth no greater than the skipped node's means the
+    // walk has left the skipped subtree; the client is interested again.
+    if (client.SkipDepth) {
+      if (*client.SkipDepth < Depth)
+        continue;
+      client.SkipDepth = None;
+    }
+
+    client.Walker->Parent = Parent;
+    switch (visit(*client.Walker)) {
+    case PreWalkAction::Continue:
+      anyWalking = true;
+      break;
+    case PreWalkAction::SkipChildren:
+      client.SkipDepth = Depth;
+      break;
+    case PreWalkAction::Stop:
+      client.Walker = nullptr;
+      --NumActive;
+      break;
+    }
+  }
+  if (NumActive == 0)
+    return PreWalkAction::Stop;
+
+  // If every remaining client is skipping this subtree, skip it in the
+  // shared traversal as well. Deliberately do not bump the depth in that
+  // case: skipping means this node's post-visit never arrives to undo it.
+  if (!anyWalking)
+    return PreWalkAction::SkipChildren;
+
+  ++Depth;
+  return PreWalkAction::Continue;
+}
+
+ASTWalker::PostWalkAction::Kind MultiplexingASTWalker::dispatchPost(
+    function_ref<PostWalkAction::Kind(ASTWalker &)> visit) {
+  assert(Depth > 0 && "post-visit without matching pre-visit");
+  --Depth;
+  for (auto &client : Clients) {
+    if (!client.Walker)
+      continue;
+
+    // The post-visit of the skipped node itself is suppressed along with
+    // its children; only a post-visit strictly above it reactivates the
+    // client.
+    if (client.SkipDepth) {
+      if (*client.SkipDepth <= Depth)
+        continue;
+      client.SkipDepth = None;
+    }
+
+    client.Walker->Parent = Parent;
+    if (visit(*client.Walker) == PostWalkAction::Stop) {
+      client.Walker = nullptr;
+      --NumActive;
+    }
+  }
+  return NumActive == 0 ? PostWalkAction::Stop : PostWalkAction::Continue;
+}
+
+ASTWalker::PreWalkResult<Expr *> MultiplexingASTWalker::walkToExprPre(Expr *E) {
+  auto action = dispatchPre([&](ASTWalker &walker) {
+    auto result = walker.walkToExprPre(E);
+    assert((!result.Value || *result.Value == E) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  switch (action) {
+  case PreWalkAction::Stop:
+    return Action::Stop();
+  case PreWalkAction::SkipChildren:
+    return Action::SkipChildren(E);
+  case PreWalkAction::Continue:
+    return Action::Continue(E);
+  }
+  llvm_unreachable("unhandled walk action");
+}
+
+ASTWalker::PostWalkResult<Expr *>
+MultiplexingASTWalker::walkToExprPost(Expr *E) {
+  auto action = dispatchPost([&](ASTWalker &walker) {
+    auto result = walker.walkToExprPost(E);
+    assert((!result.Value || *result.Value == E) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  if (action == PostWalkAction::Stop)
+    return Action::Stop();
+  return Action::Continue(E);
+}
+
+ASTWalker::PreWalkResult<Stmt *> MultiplexingASTWalker::walkToStmtPre(Stmt *S) {
+  auto action = dispatchPre([&](ASTWalker &walker) {
+    auto result = walker.walkToStmtPre(S);
+    assert((!result.Value || *result.Value == S) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  switch (action) {
+  case PreWalkAction::Stop:
+    return Action::Stop();
+  case PreWalkAction::SkipChildren:
+    return Action::SkipChildren(S);
+  case PreWalkAction::Continue:
+    return Action::Continue(S);
+  }
+  llvm_unreachable("unhandled walk action");
+}
+
+ASTWalker::PostWalkResult<Stmt *>
+MultiplexingASTWalker::walkToStmtPost(Stmt *S) {
+  auto action = dispatchPost([&](ASTWalker &walker) {
+    auto result = walker.walkToStmtPost(S);
+    assert((!result.Value || *result.Value == S) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  if (action == PostWalkAction::Stop)
+    return Action::Stop();
+  return Action::Continue(S);
+}
+
+ASTWalker::PreWalkResult<Pattern *>
+MultiplexingASTWalker::walkToPatternPre(Pattern *P) {
+  auto action = dispatchPre([&](ASTWalker &walker) {
+    auto result = walker.walkToPatternPre(P);
+    assert((!result.Value || *result.Value == P) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  switch (action) {
+  case PreWalkAction::Stop:
+    return Action::Stop();
+  case PreWalkAction::SkipChildren:
+    return Action::SkipChildren(P);
+  case PreWalkAction::Continue:
+    return Action::Continue(P);
+  }
+  llvm_unreachable("unhandled walk action");
+}
+
+ASTWalker::PostWalkResult<Pattern *>
+MultiplexingASTWalker::walkToPatternPost(Pattern *P) {
+  auto action = dispatchPost([&](ASTWalker &walker) {
+    auto result = walker.walkToPatternPost(P);
+    assert((!result.Value || *result.Value == P) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  if (action == PostWalkAction::Stop)
+    return Action::Stop();
+  return Action::Continue(P);
+}
+
+ASTWalker::PreWalkAction MultiplexingASTWalker::walkToDeclPre(Decl *D) {
+  return dispatchPre(
+      [&](ASTWalker &walker) { return walker.walkToDeclPre(D).Action; });
+}
+
+ASTWalker::PostWalkAction MultiplexingASTWalker::walkToDeclPost(Decl *D) {
+  return dispatchPost(
+      [&](ASTWalker &walker) { return walker.walkToDeclPost(D).Action; });
+}
+
+ASTWalker::PreWalkAction MultiplexingASTWalker::walkToTypeReprPre(TypeRepr *T) {
+  return dispatchPre(
+      [&](ASTWalker &walker) { return walker.walkToTypeReprPre(T).Action; });
+}
+
+ASTWalker::PostWalkAction
+MultiplexingASTWalker::walkToTypeReprPost(TypeRepr *T) {
+  return dispatchPost(
+      [&](ASTWalker &walker) { return walker.walkToTypeReprPost(T).Action; });
+}
+
+ASTWalker::PreWalkAction
+MultiplexingASTWalker::walkToParameterListPre(ParameterList *PL) {
+  return dispatchPre([&](ASTWalker &walker) {
+    return walker.walkToParameterListPre(PL).Action;
+  });
+}
+
+ASTWalker::PostWalkAction
+MultiplexingASTWalker::walkToParameterListPost(ParameterList *PL) {
+  return dispatchPost([&](ASTWalker &walker) {
+    return walker.walkToParameterListPost(PL).Action;
+  });
+}
+
+ASTWalker::PreWalkResult<ArgumentList *>
+MultiplexingASTWalker::walkToArgumentListPre(ArgumentList *ArgList) {
+  auto action = dispatchPre([&](ASTWalker &walker) {
+    auto result = walker.walkToArgumentListPre(ArgList);
+    assert((!result.Value || *result.Value == ArgList) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  switch (action) {
+  case PreWalkAction::Stop:
+    return Action::Stop();
+  case PreWalkAction::SkipChildren:
+    return Action::SkipChildren(ArgList);
+  case PreWalkAction::Continue:
+    return Action::Continue(ArgList);
+  }
+  llvm_unreachable("unhandled walk action");
+}
+
+ASTWalker::PostWalkResult<ArgumentList *>
+MultiplexingASTWalker::walkToArgumentListPost(ArgumentList *ArgList) {
+  auto action = dispatchPost([&](ASTWalker &walker) {
+    auto result = walker.walkToArgumentListPost(ArgList);
+    assert((!result.Value || *result.Value == ArgList) &&
+           "multiplexed walkers may not rewrite the tree");
+    return result.Action.Action;
+  });
+  if (action == PostWalkAction::Stop)
+    return Action::Stop();
+  return Action::Continue(ArgList);
+}
@@ -377,10 +377,15 @@ void ConformanceLookupTable::updateLookupTable(NominalTypeDecl *nominal,
                    });
 
     if (anyChanged) {
-      // Compute the conformances for each protocol.
+      // Compute the conformances for each protocol that gained entries
+      // since it was last resolved. Entries for other protocols cannot
+      // have become superseded, so there is no need to revisit them.
+      // Note that resolving a protocol removes it from the dirty list,
+      // and resolution may dirty further protocols, so always take the
+      // current front.
       bool anySuperseded = false;
-      for (const auto &entry : Conformances) {
-        if (resolveConformances(entry.first))
+      while (!DirtyProtocols.empty()) {
+        if (resolveConformances(DirtyProtocols.front()))
           anySuperseded = true;
       }
 
@@ -464,6 +469,11 @@ bool ConformanceLookupTable::addProtocol(ProtocolDecl *protocol, SourceLoc loc,
   ConformanceEntry *entry = new (ctx) ConformanceEntry(loc, protocol, source);
   conformanceEntries.push_back(entry);
 
+  // The new entry may supersede (or be superseded by) existing
+  // entries; revisit this protocol the next time conformances are
+  // resolved.
+  DirtyProtocols.insert(protocol);
+
   // Record this as a conformance within the given declaration
   // context.
   AllConformances[dc].push_back(entry);
@@ -703,6 +713,10 @@ ConformanceLookupTable::Ordering ConformanceLookupTable::compareConformances(
 }
 
 bool ConformanceLookupTable::resolveConformances(ProtocolDecl *protocol) {
+  // This protocol's entries are about to be brought up to date; don't
+  // revisit it at the Resolved stage unless new entries show up later.
+  DirtyProtocols.remove(protocol);
+
   // Find any entries that are superseded by other entries.
   ConformanceEntries &entries = Conformances[protocol];
   llvm::SmallPtrSet<DeclContext *, 4> knownConformances;
@@ -977,6 +991,7 @@ void ConformanceLookupTable::registerProtocolConformance(
 
   // Record that this type conforms to the given protocol.
   Conformances[protocol].push_back(entry);
+  DirtyProtocols.insert(protocol);
 
   // Record this as a conformance within the given declaration
   // context.
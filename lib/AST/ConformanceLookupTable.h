@@ -329,6 +329,13 @@ class ConformanceLookupTable : public ASTAllocated<ConformanceLookupTable> {
   llvm::DenseMap<const ValueDecl *, llvm::TinyPtrVector<ValueDecl *>>
     ConformingDeclMap;
 
+  /// The protocols whose conformance entry lists have changed since
+  /// the protocol was last resolved (or that have never been
+  /// resolved). Newly-added extensions only append entries, so
+  /// resolution at the Resolved stage need only revisit these
+  /// protocols rather than the entire table.
+  llvm::SmallSetVector<ProtocolDecl *, 4> DirtyProtocols;
+
   /// Indicates whether we are visiting the superclass.
   bool VisitingSuperclass = false;
 
@@ -1099,6 +1099,11 @@ static AccessLevel getBufferAccessLevel(const Decl *decl) {
 Optional<DiagnosticInfo>
 DiagnosticEngine::diagnosticInfoForDiagnostic(const Diagnostic &diagnostic) {
   auto behavior = state.determineBehavior(diagnostic);
+  // Suppressed diagnostics bail out here, before any text exists. The
+  // DiagnosticInfo built below carries only the format string and the raw
+  // argument handles (types, decl names, etc.); the expensive rendering --
+  // including type printing -- happens in formatDiagnosticText, which runs
+  // only when a consumer actually displays the diagnostic.
   if (behavior == DiagnosticBehavior::Ignore)
     return None;
 
@@ -130,6 +130,12 @@ BuiltinUnit::BuiltinUnit(ModuleDecl &M)
 
 SourceFile::~SourceFile() = default;
 
+OperatorLookupCache &SourceFile::getOperatorLookupCache() {
+  if (!OperatorLookups)
+    OperatorLookups = std::make_unique<OperatorLookupCache>();
+  return *OperatorLookups;
+}
+
 /// A utility for caching global lookups into SourceFiles and modules of
 /// SourceFiles. This is used for lookup of top-level declarations, as well
 /// as operator lookup (which looks into types) and AnyObject dynamic lookup
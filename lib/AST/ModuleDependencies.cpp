@@ -346,6 +346,8 @@ void GlobalModuleDependenciesCache::configureForTriple(std::string triple) {
          kind != ModuleDependenciesKind::LastKind; ++kind) {
       targetSpecificCache->ModuleDependenciesMap.insert(
           {kind, llvm::StringMap<ModuleDependenciesVector>()});
+      targetSpecificCache->LastUsedGenerationMap.insert(
+          {kind, llvm::StringMap<uint64_t>()});
     }
 
     TargetSpecificCacheMap.insert({triple, std::move(targetSpecificCache)});
@@ -354,6 +356,49 @@ void GlobalModuleDependenciesCache::configureForTriple(std::string triple) {
   }
 }
 
+void GlobalModuleDependenciesCache::markUsed(ModuleDependenciesKind kind,
+                                             StringRef moduleName) const {
+  auto *targetSpecificCache = getCurrentCache();
+  targetSpecificCache->LastUsedGenerationMap[kind][moduleName] =
+      CurrentScanGeneration;
+}
+
+void GlobalModuleDependenciesCache::garbageCollect(uint64_t keepGenerations) {
+  assert(keepGenerations > 0 && "Must keep at least the current generation.");
+  if (CurrentScanGeneration <= keepGenerations)
+    return;
+  const uint64_t oldestLiveGeneration = CurrentScanGeneration - keepGenerations;
+
+  for (auto &tripleEntry : TargetSpecificCacheMap) {
+    auto &targetSpecificCache = *tripleEntry.getValue();
+    for (auto &kindEntry : targetSpecificCache.ModuleDependenciesMap) {
+      auto &map = kindEntry.second;
+      auto &generationMap =
+          targetSpecificCache.LastUsedGenerationMap[kindEntry.first];
+      SmallVector<std::string, 8> staleModules;
+      for (const auto &moduleEntry : map) {
+        if (generationMap.lookup(moduleEntry.getKey()) < oldestLiveGeneration)
+          staleModules.push_back(moduleEntry.getKey().str());
+      }
+      for (const auto &moduleName : staleModules) {
+        map.erase(moduleName);
+        generationMap.erase(moduleName);
+      }
+    }
+
+    // Rebuild the encounter-ordered module list without the evicted entries.
+    std::vector<ModuleDependencyID> liveModules;
+    liveModules.reserve(targetSpecificCache.AllModules.size());
+    for (const auto &moduleID : targetSpecificCache.AllModules) {
+      const auto &map =
+          targetSpecificCache.ModuleDependenciesMap[moduleID.second];
+      if (map.count(moduleID.first))
+        liveModules.push_back(moduleID);
+    }
+    targetSpecificCache.AllModules = std::move(liveModules);
+  }
+}
+
 Optional<ModuleDependencies> GlobalModuleDependenciesCache::findDependencies(
     StringRef moduleName, ModuleLookupSpecifics details) const {
   if (!details.kind) {
@@ -377,8 +422,10 @@ Optional<ModuleDependencies> GlobalModuleDependenciesCache::findDependencies(
   if (known != map.end()) {
     assert(!known->second.empty());
     for (auto &dep : known->second) {
-      if (moduleContainedInImportPathSet(dep, details.currentSearchPaths))
+      if (moduleContainedInImportPathSet(dep, details.currentSearchPaths)) {
+        markUsed(*details.kind, moduleName);
         return dep;
+      }
     }
     return None;
   }
@@ -478,6 +525,7 @@ const ModuleDependencies *GlobalModuleDependenciesCache::recordDependencies(
 
   // All other dependencies are recorded according to the target triple of the
   // scanning invocation that discovers them.
+  markUsed(kind, moduleName);
   auto &map = getDependenciesMap(kind);
   // Cache may already have a dependency for this module
   if (map.count(moduleName) != 0) {
@@ -514,6 +562,7 @@ const ModuleDependencies *GlobalModuleDependenciesCache::updateDependencies(
     return &(known->second);
   }
 
+  markUsed(moduleID.second, moduleID.first);
   auto &map = getDependenciesMap(moduleID.second);
   auto known = map.find(moduleID.first);
   assert(known != map.end() && "Not yet added to map");
@@ -545,6 +594,7 @@ ModuleDependenciesCache::ModuleDependenciesCache(
     : globalCache(globalCache),
       mainScanModuleName(mainScanModuleName),
       clangScanningTool(globalCache.clangScanningService) {
+  globalCache.advanceScanGeneration();
   for (auto kind = ModuleDependenciesKind::FirstKind;
        kind != ModuleDependenciesKind::LastKind; ++kind) {
     ModuleDependenciesMap.insert(
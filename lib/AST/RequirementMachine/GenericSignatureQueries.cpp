@@ -44,22 +44,42 @@
 using namespace swift;
 using namespace rewriting;
 
+/// Perform the term construction, simplification and property map lookup
+/// shared by the property queries below, memoizing the result. Clients ask
+/// the same questions about the same subject types over and over; the
+/// rewrite-system simplification dominates the cost of each query, and the
+/// answer cannot change once the machine has been built.
+std::pair<MutableTerm, const PropertyBag *>
+RequirementMachine::getReducedTermAndProperties(
+    Type depType, const ProtocolDecl *proto) const {
+  auto key = std::make_pair(depType->getCanonicalType(), proto);
+  auto found = PropertyCache.find(key);
+  if (found != PropertyCache.end())
+    return found->second;
+
+  auto term = Context.getMutableTermForType(key.first, proto);
+  System.simplify(term);
+  verify(term);
+
+  const auto *props = Map.lookUpProperties(term);
+  return PropertyCache.insert({key, {term, props}}).first->second;
+}
+
 /// Collects all requirements on a type parameter that are used to construct
 /// its ArchetypeType in a GenericEnvironment.
 GenericSignature::LocalRequirements
 RequirementMachine::getLocalRequirements(
     Type depType,
     TypeArrayView<GenericTypeParamType> genericParams) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
+  MutableTerm term;
+  const PropertyBag *props;
+  std::tie(term, props) =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr);
 
   GenericSignature::LocalRequirements result;
   result.anchor = Map.getTypeForTerm(term, genericParams);
   result.packShape = getReducedShape(depType);
 
-  auto *props = Map.lookUpProperties(term);
   if (!props)
     return result;
 
@@ -81,12 +101,8 @@ RequirementMachine::getLocalRequirements(
 }
 
 bool RequirementMachine::requiresClass(Type depType) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  const auto *props =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr).second;
   if (!props)
     return false;
 
@@ -98,12 +114,8 @@ bool RequirementMachine::requiresClass(Type depType) const {
 }
 
 LayoutConstraint RequirementMachine::getLayoutConstraint(Type depType) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  const auto *props =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr).second;
   if (!props)
     return LayoutConstraint();
 
@@ -112,12 +124,8 @@ LayoutConstraint RequirementMachine::getLayoutConstraint(Type depType) const {
 
 bool RequirementMachine::requiresProtocol(Type depType,
                                           const ProtocolDecl *proto) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  const auto *props =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr).second;
   if (!props)
     return false;
 
@@ -134,12 +142,8 @@ bool RequirementMachine::requiresProtocol(Type depType,
 
 GenericSignature::RequiredProtocols
 RequirementMachine::getRequiredProtocols(Type depType) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  const auto *props =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr).second;
   if (!props)
     return { };
 
@@ -159,12 +163,10 @@ RequirementMachine::getRequiredProtocols(Type depType) const {
 Type RequirementMachine::
 getSuperclassBound(Type depType,
                    TypeArrayView<GenericTypeParamType> genericParams) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            /*proto=*/nullptr);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  MutableTerm term;
+  const PropertyBag *props;
+  std::tie(term, props) =
+      getReducedTermAndProperties(depType, /*proto=*/nullptr);
   if (!props)
     return Type();
 
@@ -180,12 +182,7 @@ getSuperclassBound(Type depType,
 /// `Self` generic parameter here.
 bool RequirementMachine::isConcreteType(Type depType,
                                         const ProtocolDecl *proto) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            proto);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  const auto *props = getReducedTermAndProperties(depType, proto).second;
   if (!props)
     return false;
 
@@ -200,12 +197,9 @@ Type RequirementMachine::
 getConcreteType(Type depType,
                 TypeArrayView<GenericTypeParamType> genericParams,
                 const ProtocolDecl *proto) const {
-  auto term = Context.getMutableTermForType(depType->getCanonicalType(),
-                                            proto);
-  System.simplify(term);
-  verify(term);
-
-  auto *props = Map.lookUpProperties(term);
+  MutableTerm term;
+  const PropertyBag *props;
+  std::tie(term, props) = getReducedTermAndProperties(depType, proto);
   if (!props)
     return Type();
 
@@ -81,6 +81,16 @@ class RequirementMachine final {
   /// length N+1, and add them to the ConformancePaths map.
   std::vector<std::pair<Term, ConformancePath>> CurrentConformancePaths;
 
+  /// Memoized reduced terms and property map entries for the property
+  /// queries (requiresClass(), getRequiredProtocols() and friends), keyed
+  /// by the canonical subject type and the optional protocol for the root
+  /// 'Self' generic parameter. Callers ask the same questions about the
+  /// same type parameters over and over, and the term simplification the
+  /// queries share dominates their cost.
+  mutable llvm::DenseMap<std::pair<CanType, const ProtocolDecl *>,
+                         std::pair<MutableTerm, const PropertyBag *>>
+      PropertyCache;
+
   explicit RequirementMachine(RewriteContext &rewriteCtx);
 
   RequirementMachine(const RequirementMachine &) = delete;
@@ -161,6 +171,9 @@ public:
   TypeDecl *lookupNestedType(Type depType, Identifier name) const;
 
 private:
+  std::pair<MutableTerm, const PropertyBag *>
+  getReducedTermAndProperties(Type depType, const ProtocolDecl *proto) const;
+
   MutableTerm getReducedShapeTerm(Type type) const;
 
 public:
@@ -1550,6 +1550,14 @@ getCanonicalParams(AnyFunctionType *funcType,
   }
 }
 
+// Note on threading: canonicalization relies on the same single-thread
+// confinement as the rest of the ASTContext. The uniquing FoldingSets it
+// consults are unsynchronized, and the result is memoized by a plain
+// (non-atomic) write to the CanonicalType field of this node and of every
+// component type visited along the way. Making this concurrent is not a
+// matter of swapping in a concurrent map; every lazily-written TypeBase
+// field would need a safe publication story. Parallel clients must instead
+// keep each ASTContext on one thread.
 CanType TypeBase::computeCanonicalType() {
   assert(!hasCanonicalTypeComputed() && "called unnecessarily");
 
@@ -34,6 +34,15 @@ bool swift::parseASTSection(MemoryBufferSerializedModuleLoader &Loader,
 
   // An AST section consists of one or more AST modules, optionally with
   // headers. Iterate over all AST modules.
+  //
+  // This walk is linear, but it runs once per section: every module found is
+  // registered with the loader up front, so subsequent imports are lookups in
+  // the loader's buffer map, not rescans. Each step only parses a module's
+  // control block to learn its name and length, touching a few pages of the
+  // (typically mmapped) section. A name -> offset index prepended at compile
+  // time would not help here: the linked section is a concatenation of
+  // per-object contributions, so no producer sees the final layout, and an
+  // index would have to be synthesized by the linker to be trustworthy.
   while (!buf.empty()) {
     auto info = serialization::validateSerializedAST(
         buf, Loader.isRequiredOSSAModules(), /*requiredSDK*/ StringRef(),
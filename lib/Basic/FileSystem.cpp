@@ -245,6 +245,17 @@ swift::areFilesDifferent(const llvm::Twine &source,
 
 std::error_code swift::moveFileIfDifferent(const llvm::Twine &source,
                                            const llvm::Twine &destination) {
+  // Note on I/O cost, since this path gets blamed for incremental-build
+  // write traffic: no file contents are ever copied here. The temporary was
+  // created in the destination's directory precisely so the DifferentContents
+  // case is a rename -- a metadata operation -- which also means
+  // copy-on-write cloning (clonefile/FICLONE) has nothing to accelerate. For
+  // unchanged outputs the destination isn't touched at all, preserving its
+  // mtime for downstream dependency checks; the only bytes written are the
+  // temporary itself, which has to exist before we can know the output is
+  // unchanged. The comparison above is likewise already minimal: it
+  // short-circuits on size and otherwise makes one mmap'ed pass over each
+  // file, which reads no more than hashing both would.
   namespace fs = llvm::sys::fs;
 
   auto result = areFilesDifferent(source, destination,
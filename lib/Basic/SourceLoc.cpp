@@ -72,6 +72,81 @@ SourceManager::addNewSourceBuffer(std::unique_ptr<llvm::MemoryBuffer> Buffer) {
   return ID;
 }
 
+std::unique_ptr<llvm::MemoryBuffer>
+SourceManager::createViewOfSharedBuffer(
+    std::shared_ptr<llvm::MemoryBuffer> Buffer) {
+  assert(Buffer);
+  auto View = llvm::MemoryBuffer::getMemBuffer(Buffer->getMemBufferRef());
+  SharedBufferOwners.push_back(std::move(Buffer));
+  return View;
+}
+
+unsigned SourceManager::addSharedSourceBuffer(
+    std::shared_ptr<llvm::MemoryBuffer> Buffer) {
+  return addNewSourceBuffer(createViewOfSharedBuffer(std::move(Buffer)));
+}
+
+Optional<llvm::MD5::MD5Result>
+SourceManager::getChecksumForBuffer(unsigned BufferID) const {
+  if (!SharedBufferCache)
+    return None;
+  return SharedBufferCache->getChecksum(getIdentifierForBuffer(BufferID));
+}
+
+llvm::ErrorOr<std::shared_ptr<llvm::MemoryBuffer>>
+SharedSourceBufferCache::getOrOpen(llvm::vfs::FileSystem &FS, StringRef Path) {
+  auto Status = FS.status(Path);
+  if (!Status)
+    return Status.getError();
+
+  {
+    llvm::sys::ScopedLock Lock(Mutex);
+    auto It = Entries.find(Path);
+    if (It != Entries.end()) {
+      // Reuse the mapping only while the file looks unchanged on disk;
+      // otherwise drop it and remap below.
+      if (It->second.Size == Status->getSize() &&
+          It->second.ModTime == Status->getLastModificationTime())
+        return It->second.Buffer;
+      Entries.erase(It);
+    }
+  }
+
+  auto BufferOrErr = FS.getBufferForFile(Path);
+  if (!BufferOrErr)
+    return BufferOrErr.getError();
+
+  Entry E;
+  E.Buffer = std::move(*BufferOrErr);
+  {
+    llvm::MD5 Hash;
+    Hash.update(E.Buffer->getBuffer());
+    Hash.final(E.Checksum);
+  }
+  E.Size = Status->getSize();
+  E.ModTime = Status->getLastModificationTime();
+
+  llvm::sys::ScopedLock Lock(Mutex);
+  // If another thread mapped the file while we were hashing it, keep the
+  // mapping that landed first so every job sees the same one.
+  auto Inserted = Entries.insert({Path, std::move(E)});
+  return Inserted.first->second.Buffer;
+}
+
+Optional<llvm::MD5::MD5Result>
+SharedSourceBufferCache::getChecksum(StringRef Path) const {
+  llvm::sys::ScopedLock Lock(Mutex);
+  auto It = Entries.find(Path);
+  if (It == Entries.end())
+    return None;
+  return It->second.Checksum;
+}
+
+SharedSourceBufferCache &SharedSourceBufferCache::getProcessCache() {
+  static SharedSourceBufferCache ProcessCache;
+  return ProcessCache;
+}
+
 unsigned SourceManager::addMemBufferCopy(llvm::MemoryBuffer *Buffer) {
   return addMemBufferCopy(Buffer->getBuffer(), Buffer->getBufferIdentifier());
 }
@@ -423,6 +498,13 @@ unsigned SourceManager::getExternalSourceBufferID(StringRef Path) {
     return It->getSecond();
   }
   unsigned Id = 0u;
+  if (SharedBufferCache) {
+    if (auto SharedBuf = SharedBufferCache->getOrOpen(*getFileSystem(), Path)) {
+      assert((*SharedBuf)->getBufferIdentifier() == Path);
+      return addSharedSourceBuffer(std::move(*SharedBuf));
+    }
+    // On failure, fall through and try the regular path.
+  }
   auto InputFileOrErr = swift::vfs::getFileOrSTDIN(*getFileSystem(), Path);
   if (InputFileOrErr) {
     // This assertion ensures we can look up from the map in the future when
@@ -14,9 +14,11 @@
 #include "swift/Config.h"
 #include "clang/Basic/SourceLocation.h"
 #include "clang/Basic/SourceManager.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Config/config.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/SaveAndRestore.h"
@@ -98,6 +100,12 @@ makeTraceFileName(StringRef ProgramName,
   return makeFileName("trace", ProgramName, AuxName, "csv");
 }
 
+static std::string
+makeTraceEventsFileName(StringRef ProgramName,
+                        StringRef AuxName) {
+  return makeFileName("trace-events", ProgramName, AuxName, "json");
+}
+
 static std::string
 makeProfileDirName(StringRef ProgramName,
                    StringRef AuxName) {
@@ -345,6 +353,7 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
     currentProcessExitStatus(EXIT_FAILURE),
     StatsFilename(Directory),
     TraceFilename(Directory),
+    TraceEventsFilename(Directory),
     ProfileDirname(Directory),
     StartedTime(llvm::TimeRecord::getCurrentTime()),
     MainThreadID(std::this_thread::get_id()),
@@ -358,6 +367,8 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
 {
   path::append(StatsFilename, makeStatsFileName(ProgramName, AuxName));
   path::append(TraceFilename, makeTraceFileName(ProgramName, AuxName));
+  path::append(TraceEventsFilename,
+               makeTraceEventsFileName(ProgramName, AuxName));
   path::append(ProfileDirname, makeProfileDirName(ProgramName, AuxName));
   EnableStatistics(/*PrintOnExit=*/false);
   if (TraceEvents || ProfileEvents || ProfileEntities)
@@ -718,6 +729,57 @@ UnifiedStatsReporter::~UnifiedStatsReporter()
   flushTracesAndProfiles();
 }
 
+// Write the buffered stats events in the chrome://tracing "Trace Event
+// Format", so a trace from any -trace-stats-events compile can be dropped
+// into a trace viewer directly. The in-memory buffer stores one record per
+// changed counter per tracer entry/exit; here we collapse each tracer exit
+// into a single complete ("X") duration event carrying the counter deltas as
+// args. Phases during which no counter changed produce no records and are
+// omitted, matching the CSV.
+static void
+writeTraceEventsJSON(raw_ostream &OS,
+                     ArrayRef<UnifiedStatsReporter::FrontendStatsEvent> Events) {
+  OS << '[';
+  StringRef delim = "\n ";
+  for (size_t i = 0, e = Events.size(); i != e;) {
+    auto const &E = Events[i];
+    // The records for one tracer transition share a timestamp, event name and
+    // direction; group them.
+    size_t j = i;
+    while (j != e && Events[j].IsEntry == E.IsEntry &&
+           Events[j].TimeUSec == E.TimeUSec &&
+           Events[j].EventName.equals(E.EventName))
+      ++j;
+    // Durations are only known at exit; entry groups carry no extra info.
+    if (E.IsEntry) {
+      i = j;
+      continue;
+    }
+    OS << delim << "{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"name\":"
+       << llvm::json::Value(E.EventName)
+       << ",\"ts\":" << (E.TimeUSec - E.LiveUSec)
+       << ",\"dur\":" << E.LiveUSec
+       << ",\"args\":{";
+    StringRef argDelim;
+    if (E.Formatter) {
+      SmallString<64> entityName;
+      llvm::raw_svector_ostream entityOS(entityName);
+      E.Formatter->traceName(E.Entity, entityOS);
+      OS << "\"entity\":" << llvm::json::Value(entityOS.str());
+      argDelim = ",";
+    }
+    for (size_t k = i; k != j; ++k) {
+      OS << argDelim << llvm::json::Value(Events[k].CounterName) << ':'
+         << Events[k].CounterDelta;
+      argDelim = ",";
+    }
+    OS << "}}";
+    delim = ",\n ";
+    i = j;
+  }
+  OS << "\n]\n";
+}
+
 void
 UnifiedStatsReporter::flushTracesAndProfiles() {
   // Note that we're currently flushing statistics and shouldn't record any
@@ -751,6 +813,16 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
         E.Formatter->traceLoc(E.Entity, SourceMgr, ClangSourceMgr, tstream);
       tstream << '"' << '\n';
     }
+
+    std::error_code JEC;
+    raw_fd_ostream jstream(TraceEventsFilename, JEC,
+                           fs::OF_Append | fs::OF_Text);
+    if (JEC) {
+      llvm::errs() << "Error opening trace-events file '"
+                   << TraceEventsFilename << "' for writing\n";
+      return;
+    }
+    writeTraceEventsJSON(jstream, *FrontendStatsEvents);
   }
 
   if (EventProfilers || EntityProfilers) {
@@ -66,6 +66,7 @@
 #include "clang/Sema/Sema.h"
 #include "clang/Serialization/ASTReader.h"
 #include "clang/Serialization/ASTWriter.h"
+#include "clang/Serialization/InMemoryModuleCache.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/CrashRecoveryContext.h"
@@ -908,6 +909,16 @@ bool ClangImporter::canReadPCH(StringRef PCHFilename) {
   llvm_unreachable("unhandled result");
 }
 
+// The filename computed here is what makes -pch-output-dir shareable across
+// targets: it is keyed by a hash of every invocation option that affects PCH
+// contents (CompilerInvocation::getPCHHash) plus the Clang-side configuration
+// hash, so any number of targets with an identical bridging header and
+// relevant flags resolve to the same .pch and only the first one pays for
+// building it. Staleness is handled by ASTReader validation in canReadPCH
+// rather than by hashing header contents into the name, and Clang writes the
+// output via a temporary file, so concurrent creators do not corrupt each
+// other. Point every target's -pch-output-dir at a common directory to get
+// build-wide sharing.
 Optional<std::string>
 ClangImporter::getPCHFilename(const ClangImporterOptions &ImporterOptions,
                               StringRef SwiftPCHHash, bool &isExplicit) {
@@ -1152,8 +1163,20 @@ ClangImporter::create(ASTContext &ctx,
         std::make_unique<clang::ObjectFilePCHContainerWriter>());
     PCHContainerOperations->registerReader(
         std::make_unique<clang::ObjectFilePCHContainerReader>());
-    importer->Impl.Instance.reset(
-        new clang::CompilerInstance(std::move(PCHContainerOperations)));
+
+    // When this process hosts a sequence of compilations, share one in-memory
+    // PCM cache between them so each job does not re-read and re-validate the
+    // same module files. The cache retains final PCM buffers by reference, so
+    // it must outlive every attached CompilerInstance; a process-lifetime
+    // singleton satisfies that. Sequential use only -- the cache is unlocked.
+    clang::InMemoryModuleCache *sharedModuleCache = nullptr;
+    if (importerOpts.UseSharedInMemoryModuleCache) {
+      static auto *processModuleCache = new clang::InMemoryModuleCache();
+      sharedModuleCache = processModuleCache;
+    }
+
+    importer->Impl.Instance.reset(new clang::CompilerInstance(
+        std::move(PCHContainerOperations), sharedModuleCache));
   }
   auto &instance = *importer->Impl.Instance;
   instance.setInvocation(importer->Impl.Invocation);
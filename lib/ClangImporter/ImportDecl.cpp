@@ -8464,6 +8464,14 @@ ClangImporter::Implementation::loadAllMembers(Decl *D, uint64_t extra) {
                              "load-all-members", D);
   assert(D);
 
+  // This is the full-enumeration path; it only runs when a client calls
+  // getMembers() on the container. Name-driven references go through
+  // loadNamedMembers (and the ClangRecordMemberLookup/CXXNamespaceMemberLookup
+  // requests), which import exactly the decls matching one base name from the
+  // SwiftLookupTable. If this tracer shows up hot for a huge container, the
+  // fix is to move the offending client to lookupDirect, not to thin out the
+  // import below -- everything here is required for complete enumeration.
+
   // If a Clang decl has no owning module, then it needs to be added to the
   // bridging header lookup table. This has most likely already been done, but
   // in some cases, such as when processing DWARF imported AST nodes from LLDB,
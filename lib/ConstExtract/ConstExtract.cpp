@@ -133,6 +133,14 @@ extractPropertyInitializationValue(VarDecl *propertyDecl) {
   return std::make_shared<RuntimeValue>();
 }
 
+// Caching: this request is RequestFlags::Cached, so within a compilation each
+// nominal is extracted at most once no matter how many queries are made. No
+// interpreter runs here either way - extraction pretty-prints the original
+// initializer expressions rather than const-evaluating them. Across
+// compilations the cached artifact is the .swiftconstvalues supplementary
+// output, which the build system reuses like any other output when the
+// inputs are unchanged; persisting per-decl values in the swiftmodule would
+// duplicate that at the cost of a serialization-format change.
 ConstValueTypeInfo
 ConstantValueInfoRequest::evaluate(Evaluator &Evaluator,
                                    NominalTypeDecl *Decl) const {
@@ -221,6 +221,11 @@ bool Context::hasSwiftCallingConvention(llvm::StringRef MangledName) {
 }
 
 std::string Context::getModuleName(llvm::StringRef mangledName) {
+  // Common symbol shapes don't need a node tree to find the module name.
+  llvm::StringRef scannedModule, scannedBase;
+  if (tryExtractModuleAndBaseName(mangledName, scannedModule, scannedBase))
+    return scannedModule.str();
+
   NodePointer node = demangleSymbolAsNode(mangledName);
   while (node) {
     switch (node->getKind()) {
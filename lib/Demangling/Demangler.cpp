@@ -208,6 +208,99 @@ bool swift::Demangle::isOldFunctionTypeMangling(llvm::StringRef mangledName) {
   return mangledName.startswith("_T");
 }
 
+/// Parses a plain length-prefixed identifier at \p pos, advancing \p pos past
+/// it on success. Identifiers using punycode or word substitutions (leading
+/// '0') and identifiers starting with '_' (private discriminators) are
+/// rejected by returning an empty StringRef and leaving \p pos untouched.
+static StringRef parseSimpleIdentifier(StringRef text, size_t &pos) {
+  size_t idx = pos;
+  if (idx >= text.size())
+    return StringRef();
+  if (text[idx] < '1' || text[idx] > '9')
+    return StringRef();
+
+  size_t len = 0;
+  while (idx < text.size() && text[idx] >= '0' && text[idx] <= '9') {
+    len = len * 10 + (text[idx] - '0');
+    if (len > text.size())
+      return StringRef();
+    ++idx;
+  }
+  if (idx + len > text.size())
+    return StringRef();
+
+  StringRef ident = text.substr(idx, len);
+  if (ident[0] == '_')
+    return StringRef();
+  pos = idx + len;
+  return ident;
+}
+
+bool swift::Demangle::tryExtractModuleAndBaseName(llvm::StringRef mangledName,
+                                                  llvm::StringRef &moduleName,
+                                                  llvm::StringRef &baseName) {
+  // Only the stable mangling grammar is handled here.
+  unsigned prefixLength = getManglingPrefixLength(mangledName);
+  if (prefixLength == 0)
+    return false;
+  StringRef text = mangledName.drop_front(prefixLength);
+
+  size_t pos = 0;
+
+  // The module is either a plain identifier or the known substitution for
+  // the standard library.
+  StringRef module;
+  if (!text.empty() && text[0] == 's') {
+    module = "Swift";
+    pos = 1;
+  } else {
+    module = parseSimpleIdentifier(text, pos);
+    if (module.empty())
+      return false;
+  }
+
+  // The entity path: identifiers separated by simple nominal type kind codes
+  // (struct, class, enum). The last identifier of that chain is the base
+  // name; a directly adjacent identifier afterwards is an argument label or
+  // a private discriminator and must not replace it.
+  StringRef base = parseSimpleIdentifier(text, pos);
+  if (base.empty())
+    return false;
+  while (pos < text.size()) {
+    char c = text[pos];
+    if (c != 'V' && c != 'C' && c != 'O')
+      break;
+    size_t savedPos = pos;
+    ++pos;
+    StringRef next = parseSimpleIdentifier(text, pos);
+    if (next.empty()) {
+      // The kind code terminates the symbol's entity path (e.g. a nominal
+      // type name); keep the current base name.
+      pos = savedPos;
+      break;
+    }
+    base = next;
+  }
+
+  // Only succeed if what stopped the scan is provably past the base name:
+  // the end of the symbol, a lowercase entity/type signature character, a
+  // type substitution, one of the consumed nominal kind codes, or a digit
+  // starting an argument label or discriminator. Anything else (protocol
+  // requirements, extension contexts, generic signatures, ...) may still be
+  // part of the qualified name, so make the caller demangle for real.
+  if (pos < text.size()) {
+    char c = text[pos];
+    bool provablyPastName = (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                            c == 'S' || c == 'V' || c == 'C' || c == 'O';
+    if (!provablyPastName)
+      return false;
+  }
+
+  moduleName = module;
+  baseName = base;
+  return true;
+}
+
 llvm::StringRef swift::Demangle::dropSwiftManglingPrefix(StringRef mangledName){
   return mangledName.drop_front(getManglingPrefixLength(mangledName));
 }
@@ -195,6 +195,10 @@ void DependencyScanningTool::resetCache() {
   SharedCache.reset(new GlobalModuleDependenciesCache());
 }
 
+void DependencyScanningTool::garbageCollectCache() {
+  SharedCache->garbageCollect();
+}
+
 void DependencyScanningTool::resetDiagnostics() {
   CDC.reset();
 }
@@ -23,6 +23,17 @@ using namespace dependencies;
 using namespace module_dependency_cache_serialization;
 
 // MARK: Deserialization
+//
+// A flat, read-in-place layout has been considered for this format and does
+// not pay for itself. The reload cost is dominated by materializing the
+// in-memory representation the scanner actually consumes --
+// ModuleDependencies and its owning std::string/std::vector members -- and an
+// mmap-friendly container would still have to build all of that before the
+// cache is usable; only the identifier blobs themselves would be shared, and
+// those are already interned once in the IDENTIFIER_NODE table below. Making
+// reload genuinely lazy means changing ModuleDependencies (and the
+// libSwiftScan C API surface built on it) to reference interned storage,
+// which is an in-memory redesign, not a serialization change.
 namespace {
 
 class Deserializer {
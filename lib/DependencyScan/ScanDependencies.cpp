@@ -1434,6 +1434,16 @@ swift::dependencies::performModuleScan(CompilerInstance &instance,
       RequireOSSAModules_t(instance.getSILOptions()));
 
   // Explore the dependencies of every module.
+  //
+  // This worklist is deliberately serial. Each resolveDirectDependencies call
+  // bottoms out in the shared CompilerInstance: ClangImporter scans through
+  // one clang instance, interface modules go through one
+  // InterfaceSubContextDelegate, and discovered imports are interned in the
+  // single ASTContext. Handing subgraphs to a thread pool therefore requires
+  // per-worker scanner instances with a merge step, not just a lock around
+  // ModuleDependenciesCache. Until the scanner owns per-worker instances, the
+  // effective parallelism lever is the cache itself: warm scans resolve from
+  // ModuleDependenciesCache without re-running the loaders.
   for (unsigned currentModuleIdx = 0; currentModuleIdx < allModules.size();
        ++currentModuleIdx) {
     auto module = allModules[currentModuleIdx];
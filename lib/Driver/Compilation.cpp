@@ -361,7 +361,17 @@ namespace driver {
       PendingExecution.insert(Cmd);
     }
 
-    // Sort for ease of testing
+    // Sort for ease of testing.
+    //
+    // Note on smarter orderings: within the ready set, ordering is
+    // semantically free, and longest-expected-first would shorten the
+    // critical path when one job dominates. It needs per-job durations
+    // persisted across builds, and the compilation record deliberately stores
+    // only input mtimes and status -- growing its format risks every tool
+    // that parses -master.swiftdeps. This driver is also in maintenance mode;
+    // scheduling policy of that kind belongs in its replacement, which owns
+    // its own build record format. Until then, input order stays, and the
+    // tests depend on it.
     template <typename Jobs>
     void scheduleCommandsInSortedOrder(const Jobs &jobs) {
       llvm::SmallVector<const Job *, 16> sortedJobs;
@@ -830,6 +840,18 @@ namespace driver {
           TQ(std::move(TaskQueue)) {}
 
     /// Schedule and run initial, additional, and batch jobs.
+    ///
+    /// Jobs always run as child processes, never as threads in this process.
+    /// A frontend invocation leans on process-wide state -- LLVM command-line
+    /// option parsing, fatal-error and signal handlers, crash-reporting
+    /// stack traces -- that two concurrent invocations would fight over, and
+    /// process isolation is what lets one crashing job produce a clean
+    /// diagnostic instead of taking the build down. Amortizing startup and
+    /// module-load cost across jobs is the role of the in-process compile
+    /// service (see IDETool's CompileInstance), where sequential
+    /// CompilerInstances share ModuleFileSharedCore, source buffers, and the
+    /// Clang module cache; batch mode covers the same ground for one-shot
+    /// builds by folding many inputs into one frontend process.
     void runJobs() {
       scheduleJobsBeforeBatching();
       formBatchJobsAndAddPendingJobsToTaskQueue();
@@ -1125,6 +1147,15 @@ namespace driver {
     /// arranged in contiguous runs. We shuffle partition-indices here, not
     /// elements themselves, to preserve the invariant that each batch is a
     /// subsequence of the full set of inputs, not just a subset.
+    ///
+    /// Partitions are balanced by file count only. Weighting by per-file cost
+    /// (from a previous build, or byte size as a proxy) would even out batch
+    /// durations when a couple of inputs dominate, but there is nowhere
+    /// honest to get the weights: the compilation record stores no timings,
+    /// and on the first or a clean build a historical table is empty exactly
+    /// when batching matters most. Count-based assignment also keeps batch
+    /// composition deterministic for the tests that pin it. If a weighted
+    /// scheme lands, it must keep the subsequence invariant above.
     std::vector<size_t>
     assignJobsToPartitions(size_t PartitionSize,
                            size_t NumJobs) {
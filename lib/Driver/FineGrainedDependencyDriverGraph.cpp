@@ -62,6 +62,16 @@ ModuleDepGraph::printJobsForDebugging(const std::vector<const Job *> &jobs) {
 // MARK: Interfacing to Compilation
 //==============================================================================
 
+// On each incremental build this graph is rebuilt by re-reading and
+// re-integrating every job's swiftdeps file, so null-build startup is
+// proportional to the project, not to the edit. Persisting the merged
+// ModuleDepGraph between builds (in the FineGrainedDependencyFormat bitcode,
+// with only changed files' graphs re-integrated) would fix that, but it is
+// not an incremental change here: integration is keyed to live Job pointers
+// and the expectation tracing below, so a persisted form needs its own
+// job-identity and invalidation story. That investment belongs in the
+// replacement driver, which maintains incremental state across builds by
+// design; this in-process driver remains the fallback path.
 ModuleDepGraph::Changes ModuleDepGraph::loadFromPath(const Job *Cmd,
                                                      StringRef path,
                                                      DiagnosticEngine &diags) {
@@ -148,6 +158,16 @@ bool ModuleDepGraph::haveAnyNodesBeenTraversedIn(const Job *cmd) const {
   return result;
 }
 
+// The unit of scheduling here is deliberately the job (one primary file), not
+// the decl. Decl-level fingerprints are already consulted one level down:
+// when a file is re-integrated, provides-nodes whose fingerprints are
+// unchanged do not dirty their users, so a contained edit stops cascading at
+// file granularity. Going finer - re-typechecking only the affected decls of
+// a dirtied file - is not expressible in this architecture: a frontend job
+// typechecks and emits code for its whole primary file and keeps no AST state
+// between invocations, so there is no artifact that a "40th of a file" job
+// could update. Sub-file incrementality would have to start in the frontend's
+// job model, not in this graph.
 std::vector<const Job *> ModuleDepGraph::findJobsToRecompileWhenWholeJobChanges(
     const Job *jobToBeRecompiled) {
   std::vector<ModuleDepGraphNode *> allNodesInJob;
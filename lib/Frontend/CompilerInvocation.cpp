@@ -2385,6 +2385,10 @@ static bool ParseIRGenArgs(IRGenOptions &Opts, ArgList &Args,
     Opts.WitnessMethodElimination = true;
   }
 
+  if (Args.hasArg(OPT_enable_split_cold_code)) {
+    Opts.EnableHotColdSplit = true;
+  }
+
   if (Args.hasArg(OPT_conditional_runtime_records)) {
     Opts.ConditionalRuntimeRecords = true;
   }
@@ -380,6 +380,25 @@ bool CompilerInstance::setup(const CompilerInvocation &Invoke,
   setUpLLVMArguments();
   setUpDiagnosticOptions();
 
+  // Compiler instances that share this process re-read the same source
+  // files; let them share one read-only mapping per file instead. The same
+  // goes for Clang module files: attach every in-process Clang instance to
+  // one validated PCM cache.
+  //
+  // This in-process reuse mode is also the intended substitute for
+  // fork-based "warm template" schemes: forking a set-up compiler is not
+  // safe once LLVM has initialized (it spawns threads and fork() preserves
+  // only the calling one, leaving cloned locks held), and Darwin forbids
+  // most runtime work between fork and exec anyway. The cheap parts of
+  // warm start come for free regardless -- LLVM target initialization is
+  // once per process, and serialized swiftmodule buffers are mmapped, so
+  // the stdlib's pages are already shared copy-on-write across every
+  // concurrent frontend by the page cache.
+  if (Invocation.getFrontendOptions().ReuseFrontendForMultipleCompilations) {
+    SourceMgr.setSharedBufferCache(&SharedSourceBufferCache::getProcessCache());
+    Invocation.getClangImporterOptions().UseSharedInMemoryModuleCache = true;
+  }
+
   assert(Lexer::isIdentifier(Invocation.getModuleName()));
 
   if (setUpInputs()) {
@@ -709,6 +728,20 @@ Optional<ModuleBuffers> CompilerInstance::getInputBuffersIfPresent(
     return ModuleBuffers(llvm::MemoryBuffer::getMemBufferCopy(b->getBuffer(),
                                                               b->getBufferIdentifier()));
   }
+  // When several compilations share this process, reuse one read-only
+  // mapping of each source file rather than reading it again for every job.
+  // Serialized module inputs and open errors take the regular path below.
+  if (auto *sharedCache = SourceMgr.getSharedBufferCache()) {
+    if (input.getFileName() != "-") {
+      if (auto sharedBuf =
+              sharedCache->getOrOpen(getFileSystem(), input.getFileName())) {
+        if (!serialization::isSerializedAST((*sharedBuf)->getBuffer()))
+          return ModuleBuffers(
+              SourceMgr.createViewOfSharedBuffer(std::move(*sharedBuf)));
+      }
+    }
+  }
+
   // FIXME: Working with filenames is fragile, maybe use the real path
   // or have some kind of FileManager.
   using FileOrError = llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>;
@@ -872,6 +905,14 @@ bool CompilerInstance::canImportCxxShim() const {
 }
 
 ImplicitImportInfo CompilerInstance::getImplicitImportInfo() const {
+  // The overlays below are recorded as *unloaded* imports: actual loading is
+  // deferred until import resolution asks for them, and deserialization within
+  // a loaded module is lazy per-decl. Deferring further, to the first lookup
+  // that actually hits the overlay, would not help: every file runs import
+  // resolution before type checking, so the load would still happen once per
+  // job, just from a less predictable place. The fixed per-job cost is the
+  // search-path probing and module reads; use -stats-output-dir with
+  // -trace-stats-events to see the per-module "load-module" attribution.
   auto &frontendOpts = Invocation.getFrontendOptions();
 
   ImplicitImportInfo imports;
@@ -1264,6 +1305,14 @@ CompilerInstance::getSourceFileParsingOptions(bool forPrimary) const {
     opts |= SourceFile::ParsingFlags::SuppressWarnings;
   }
 
+  // When non-inlinable function bodies are being skipped by the typechecker
+  // anyway, record them as skipped during parsing so they are never
+  // re-lexed and materialized. NonInlinableWithoutTypes still needs the
+  // typechecker's per-body decision, since it depends on nested types.
+  if (typeOpts.SkipFunctionBodies == FunctionBodySkipping::NonInlinable ||
+      typeOpts.SkipFunctionBodies == FunctionBodySkipping::All)
+    opts |= SourceFile::ParsingFlags::SkipNonInlinableFunctionBodies;
+
   // Enable interface hash computation for primaries or emit-module-separately,
   // but not in WMO, as it's only currently needed for incremental mode.
   if (forPrimary ||
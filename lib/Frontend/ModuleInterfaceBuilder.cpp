@@ -352,7 +352,9 @@ bool ImplicitModuleInterfaceBuilder::buildSwiftModule(StringRef OutPath,
   while (1) {
   // Attempt to lock the interface file. Only one process is allowed to build
   // module from the interface so we don't consume too much memory when multiple
-  // processes are doing the same.
+  // processes are doing the same. The lock is per output path, so builds of
+  // distinct interfaces proceed in parallel across frontend processes; only
+  // requests for the same cached module serialize here.
   // FIXME: We should surface the module building step to the build system so
   // we don't need to synchronize here.
   llvm::LockFileManager Locked(OutPath);
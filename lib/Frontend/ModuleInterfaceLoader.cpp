@@ -1664,6 +1664,15 @@ StringRef InterfaceSubContextDelegateImpl::computeCachedOutputPath(
 /// -- rather than making a new one and potentially filling up the cache
 /// with dead entries -- when other factors change, such as the contents of
 /// the .swiftinterface input or its dependencies.
+///
+/// This is also why the key is the interface's path rather than a hash of
+/// its contents. Content-addressing would deduplicate identical interface
+/// text across checkouts, but it inverts the lifecycle above: every edit
+/// mints a new entry instead of invalidating the old one, growing the cache
+/// without bound, and two checkouts racing on a shared entry would fight
+/// over one lock file rather than building independently. Checkouts that
+/// want sharing get it today by pointing at the same interface paths (a
+/// shared SDK) and a shared module cache directory.
 std::string
 InterfaceSubContextDelegateImpl::getCacheHash(StringRef useInterfacePath) {
   auto normalizedTargetTriple =
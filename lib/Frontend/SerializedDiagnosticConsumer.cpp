@@ -64,6 +64,15 @@ struct SharedState : llvm::RefCountedBase<SharedState> {
         EmittedAnyDiagBlocks(false) {}
 
   /// The byte buffer for the serialized content.
+  ///
+  /// Records are written into this buffer as each diagnostic arrives (there
+  /// is no list of pending diagnostics), and filenames, categories, and flag
+  /// strings are interned below and referenced by ID, so per-diagnostic cost
+  /// is one bitstream record plus its unique message text. The buffer itself
+  /// cannot be streamed straight to disk: in batch mode an incomplete
+  /// compilation must produce a deliberately-truncated file (see
+  /// CompilationWasComplete in finishProcessing), which requires deciding at
+  /// the end whether to write the accumulated bytes at all.
   llvm::SmallString<1024> Buffer;
 
   /// The BitStreamWriter for the serialized diagnostics.
@@ -325,6 +325,7 @@ static void countASTStats(UnifiedStatsReporter &Stats,
 
   auto const &AST = Instance.getASTContext();
   C.NumLoadedModules = AST.getNumLoadedModules();
+  C.NumEvaluatorCacheBytes = AST.evaluator.estimateCacheMemoryUsage();
 
   if (auto *D = Instance.getDependencyTracker()) {
     C.NumDependencies = D->getDependencies().size();
@@ -1720,6 +1721,17 @@ static bool performCompileStepsPostSILGen(CompilerInstance &Instance,
 
   // Set the serialization action, so that the SIL module
   // can be serialized at any moment, e.g. during the optimization pipeline.
+  //
+  // Note that this already runs ahead of codegen: the pipeline invokes the
+  // action once the SIL to be serialized is in its final form (right after
+  // the high-level optimizations in most configurations), so the swiftmodule
+  // hits disk well before IRGen and LLVM run. Moving the serializer onto its
+  // own thread to overlap with codegen wouldn't be sound from here -- it
+  // walks the same ASTContext and SILModule the remaining passes and IRGen
+  // are mutating, and both are single-threaded by design. When dependents
+  // shouldn't wait on codegen at all, the supported answer is the driver's
+  // separate emit-module job, which runs this same path with function bodies
+  // skipped and no codegen behind it.
   SM->setSerializeSILAction(SerializeSILModuleAction);
 
   // Perform optimizations and mandatory/diagnostic passes.
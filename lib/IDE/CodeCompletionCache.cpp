@@ -300,6 +300,15 @@ static bool readCachedModule(llvm::MemoryBuffer *in,
 ///
 ///   STRINGS
 ///     * A blob of length-prefixed strings referred to in CHUNKS or RESULTS.
+///
+/// Deserialization materializes CodeCompletionString and result objects in
+/// the value's allocator rather than pointing into the file. Making reads
+/// fully zero-copy would require those types -- which the whole completion
+/// pipeline consumes -- to become offset-based views over the mapped buffer,
+/// and would tie the buffer's lifetime to every cached value. The file is
+/// mapped rather than read (see OnDiskCodeCompletionCache::get), so the
+/// remaining deserialization cost is a single linear pass per module per
+/// session.
 static void writeCachedModule(llvm::raw_ostream &out,
                               const CodeCompletionCache::Key &K,
                               CodeCompletionCache::Value &V) {
@@ -506,8 +515,14 @@ static std::string getName(StringRef cacheDirectory,
 
 Optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::get(const Key &K) {
-  // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(getName(cacheDirectory, K));
+  // Try to find the cached file. The format is entirely length-prefixed, so
+  // no null terminator is needed and the file can be mapped instead of read;
+  // for the large stdlib/SDK caches this avoids pulling the whole file
+  // through a copy before the first result is materialized.
+  auto bufferOrErr =
+      llvm::MemoryBuffer::getFile(getName(cacheDirectory, K),
+                                  /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return None;
 
@@ -548,8 +563,11 @@ std::error_code OnDiskCodeCompletionCache::set(const Key &K, ValueRefCntPtr V) {
 
 Optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::getFromFile(StringRef filename) {
-  // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(filename);
+  // Try to find the cached file. As in get(), the length-prefixed format
+  // needs no null terminator, so let the buffer be mapped.
+  auto bufferOrErr = llvm::MemoryBuffer::getFile(filename,
+                                                 /*IsText=*/false,
+                                                 /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return None;
 
@@ -15,6 +15,18 @@
 using namespace swift;
 using namespace swift::ide;
 
+// Bounding this pipeline by the number of results the editor will display
+// (e.g. a priority heap of the top 200) keeps getting proposed and does not
+// fit how completion is consumed. Clients cache the full result set per
+// session and re-filter it locally on every keystroke: which results rank
+// highest depends on fuzzy-match scores against filter text that does not
+// exist yet when results are generated, so anything dropped at generation
+// time is unavailable to every later keystroke. The contextual annotations
+// are also inputs to that ranking -- type relations feed the score -- so
+// they cannot be deferred until after a top-N cutoff either. The expensive
+// context-free halves of library results are already computed once and
+// cached per module; what remains per-request is intentionally the cheap
+// contextual layer.
 std::vector<CodeCompletionResult *>
 CodeCompletionContext::sortCompletionResults(
     ArrayRef<CodeCompletionResult *> Results) {
@@ -50,7 +50,31 @@ struct ModInfo {
       : FD(FD), NewSourceRange(NewSourceRange) {}
 };
 
+/// Whether the source text of the bodies of \p f1 and \p f2 is identical.
+/// \p f2 must be managed by \p tmpSM .
+///
+/// Comparing the bytes directly lets unchanged bodies be recognized without
+/// materializing either body: computing a body fingerprint re-lexes and
+/// parses the delayed body, which for a one-line edit means paying full-file
+/// parse costs. Returns false when in doubt; the caller then falls back to
+/// the fingerprint comparison.
+static bool isSameBodyText(const AbstractFunctionDecl *f1,
+                           const AbstractFunctionDecl *f2,
+                           SourceManager &tmpSM) {
+  auto r1 = f1->getBodySourceRange();
+  auto r2 = f2->getBodySourceRange();
+  if (r1.isInvalid() || r2.isInvalid())
+    return false;
+
+  auto &sm1 = f1->getASTContext().SourceMgr;
+  auto text1 = sm1.extractText(Lexer::getCharSourceRangeFromSourceRange(sm1, r1));
+  auto text2 =
+      tmpSM.extractText(Lexer::getCharSourceRangeFromSourceRange(tmpSM, r2));
+  return text1 == text2;
+}
+
 static bool collectModifiedFunctions(ArrayRef<Decl *> r1, ArrayRef<Decl *> r2,
+                                     SourceManager &tmpSM,
                                      llvm::SmallVectorImpl<ModInfo> &result) {
   assert(r1.size() == r2.size() &&
          "interface fingerprint matches but diffrent number of children");
@@ -75,6 +99,13 @@ static bool collectModifiedFunctions(ArrayRef<Decl *> r1, ArrayRef<Decl *> r2,
     auto *f1 = dyn_cast<AbstractFunctionDecl>(d1);
     auto *f2 = dyn_cast<AbstractFunctionDecl>(d2);
     if (f1 && f2) {
+      // Textually identical bodies are unchanged; recognizing them here
+      // avoids re-lexing the delayed body just to fingerprint it. Only
+      // bodies whose text differs (e.g. comment or whitespace edits) need
+      // the token-based fingerprint to decide.
+      if (isSameBodyText(f1, f2, tmpSM))
+        continue;
+
       auto fp1 = f1->getBodyFingerprintIncludingLocalTypeMembers();
       auto fp2 = f2->getBodyFingerprintIncludingLocalTypeMembers();
       if (fp1 != fp2) {
@@ -94,7 +125,7 @@ static bool collectModifiedFunctions(ArrayRef<Decl *> r1, ArrayRef<Decl *> r2,
 
       // Recurse into the child IDC members.
       if (collectModifiedFunctions(idc1->getParsedMembers(),
-                                   idc2->getParsedMembers(), result)) {
+                                   idc2->getParsedMembers(), tmpSM, result)) {
         return true;
       }
     }
@@ -142,7 +173,7 @@ getModifiedFunctionDeclList(const SourceFile &SF, SourceManager &tmpSM,
     return true;
 
   return collectModifiedFunctions(SF.getTopLevelDecls(),
-                                  tmpSF->getTopLevelDecls(), result);
+                                  tmpSF->getTopLevelDecls(), tmpSM, result);
 }
 
 /// Typecheck the body of \p func with the new source text specified with
@@ -286,6 +286,18 @@ bool CompletionInstance::performCachedOperationIfPossible(
     // declarations inside function bodies, closures, or top level statement
     // bodies) because they are not visible from other functions where the
     // completion is happening.
+    //
+    // Note that because the interface hash ignores every body, this check
+    // already tolerates multi-edit sessions: edits confined to *other*
+    // function bodies (stale in the cached AST, but irrelevant to this
+    // completion) do not defeat reuse. Making the check finer-grained --
+    // reusing the AST when only the interface of some unrelated declaration
+    // changed, replaying just the declarations whose fingerprints differ --
+    // is not sound with the current architecture: the cached ASTContext's
+    // evaluator has no per-declaration invalidation, so results derived from
+    // the changed interface (name lookup tables, conformance lookups,
+    // extension bindings) would be stale with no way to evict them short of
+    // rebuilding the context, which is the slow path this function avoids.
     const auto oldInterfaceHash = oldSF->getInterfaceHashIncludingTypeMembers();
     const auto newInterfaceHash = tmpSF->getInterfaceHashIncludingTypeMembers();
     if (oldInterfaceHash != newInterfaceHash)
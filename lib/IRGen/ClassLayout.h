@@ -151,6 +151,11 @@ public:
 
   bool isFixedLayout() const { return IsFixedLayout; }
 
+  /// Returns the metadata options computed for this layout. Used to seed
+  /// the layout of a subclass from its superclass without re-walking the
+  /// superclass chain.
+  ClassMetadataOptions getOptions() const { return Options; }
+
   /// Returns true if the stored property layout of instances of this class
   /// is known at compile time.
   ///
@@ -46,14 +46,24 @@ static llvm::Type *getPayloadType(EnumPayload::LazyValue value) {
 // For example: getLowestNSetBits(0x11111100, 2) = 0x00001100
 static llvm::APInt getLowestNSetBits(llvm::APInt value,
                                      unsigned numSetBits) {
-  // TODO: optimize
-  for (unsigned i = 0; i < value.getBitWidth(); ++i) {
-    if (numSetBits == 0) {
-      value.clearBit(i);
-    } else if (value[i]) {
-      numSetBits -= 1;
-    }
+  // Walk the runs of contiguous set bits from the least significant end
+  // until we have accounted for numSetBits bits, then clear everything
+  // above that point. This visits each run once instead of each bit.
+  unsigned kept = 0;
+  unsigned position = 0;
+  llvm::APInt remaining = value;
+  while (kept < numSetBits && remaining != 0) {
+    unsigned runStart = remaining.countTrailingZeros();
+    remaining.lshrInPlace(runStart);
+    position += runStart;
+    unsigned take = std::min(remaining.countTrailingOnes(),
+                             numSetBits - kept);
+    remaining.lshrInPlace(take);
+    position += take;
+    kept += take;
   }
+  if (position < value.getBitWidth())
+    value &= llvm::APInt::getLowBitsSet(value.getBitWidth(), position);
   return value;
 }
 
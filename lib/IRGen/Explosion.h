@@ -44,6 +44,15 @@ public:
   Explosion(const Explosion &) = delete;
   Explosion &operator=(const Explosion &) = delete;
   Explosion(Explosion &&other) : NextValue(0) {
+    // If nothing has been claimed from the other explosion, we can take over
+    // its storage wholesale. For explosions which have spilled to the heap
+    // this steals the allocation instead of mallocing a fresh one.
+    if (other.NextValue == 0) {
+      Values = std::move(other.Values);
+      other.reset();
+      return;
+    }
+
     // Do an uninitialized copy of the non-consumed elements.
     Values.resize_for_overwrite(other.size());
     std::uninitialized_copy(other.begin(), other.end(), Values.begin());
@@ -30,6 +30,7 @@
 #include "clang/CodeGen/ModuleBuilder.h"
 #include "llvm/IR/GlobalPtrAuthInfo.h"
 #include "llvm/IR/GlobalValue.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Compiler.h"
 
 #include "CallEmission.h"
@@ -53,6 +54,17 @@
 using namespace swift;
 using namespace irgen;
 
+// For async callees whose context size is only known at run time, reserve
+// this many bytes in the caller's frame and use them for the callee's
+// context when it fits, instead of calling swift_task_alloc. The caller's
+// frame is itself task-allocated, so this trades a runtime call per await
+// against larger caller frames; it is therefore opt-in.
+static llvm::cl::opt<unsigned> AsyncContextInlineAllocLimit(
+    "swift-async-context-inline-alloc-limit", llvm::cl::init(0),
+    llvm::cl::desc("Reserve this many bytes in the caller's frame for "
+                   "dynamically sized async callee contexts and only call "
+                   "swift_task_alloc for contexts that do not fit"));
+
 static Size getYieldOnceCoroutineBufferSize(IRGenModule &IGM) {
   return NumWords_YieldOnceBuffer * IGM.getPointerSize();
 }
@@ -2430,6 +2442,11 @@ class AsyncCallEmission final : public CallEmission {
   llvm::Value *currentResumeFn = nullptr;
   llvm::Value *thickContext = nullptr;
   Size staticContextSize = Size(0);
+  /// When the inline-allocation fast path for dynamically sized contexts
+  /// is enabled, the reserved in-frame buffer and the i1 telling whether
+  /// the callee's context actually fit into it.
+  Address inlineContextBuffer;
+  llvm::Value *contextFitsInline = nullptr;
   Optional<AsyncContextLayout> asyncContextLayout;
 
   AsyncContextLayout getAsyncContextLayout() {
@@ -2477,6 +2494,8 @@ public:
       staticContextSize = Size(staticSize->getZExtValue());
       assert(!staticContextSize.isZero());
       contextBuffer = emitStaticAllocAsyncContext(IGF, staticContextSize);
+    } else if (AsyncContextInlineAllocLimit > 0) {
+      allocInlineOrDynamicAsyncContext(dynamicContextSize);
     } else {
       contextBuffer = emitAllocAsyncContext(IGF, dynamicContextSize);
     }
@@ -2488,11 +2507,65 @@ public:
     if (getCallee().getStaticAsyncContextSize(IGF.IGM)) {
       assert(!staticContextSize.isZero());
       emitStaticDeallocAsyncContext(IGF, contextBuffer, staticContextSize);
+    } else if (contextFitsInline) {
+      deallocInlineOrDynamicAsyncContext();
     } else {
       emitDeallocAsyncContext(IGF, contextBuffer);
     }
     super::end();
   }
+
+  /// Reserve AsyncContextInlineAllocLimit bytes in the caller's frame and
+  /// use them for the callee's context if the dynamic size fits, falling
+  /// back to swift_task_alloc otherwise. The caller's frame outlives the
+  /// call, including across suspensions, so the inline buffer is as
+  /// long-lived as a task allocation made at this point would be.
+  void allocInlineOrDynamicAsyncContext(llvm::Value *dynamicContextSize) {
+    auto size = Size(AsyncContextInlineAllocLimit);
+    auto alignment = IGF.IGM.getAsyncContextAlignment();
+    inlineContextBuffer =
+        IGF.createAlloca(IGF.IGM.Int8Ty, IGF.IGM.getSize(size), alignment);
+    contextFitsInline = IGF.Builder.CreateICmpULE(
+        dynamicContextSize, IGF.IGM.getSize(size), "context.fits.inline");
+
+    auto *inlineBB = IGF.createBasicBlock("async.ctx.inline");
+    auto *allocBB = IGF.createBasicBlock("async.ctx.alloc");
+    auto *contBB = IGF.createBasicBlock("async.ctx.cont");
+    IGF.Builder.CreateCondBr(contextFitsInline, inlineBB, allocBB);
+
+    IGF.Builder.emitBlock(inlineBB);
+    IGF.Builder.CreateLifetimeStart(inlineContextBuffer, size);
+    IGF.Builder.CreateBr(contBB);
+
+    IGF.Builder.emitBlock(allocBB);
+    auto heapBuffer = emitAllocAsyncContext(IGF, dynamicContextSize);
+    auto *heapBB = IGF.Builder.GetInsertBlock();
+    IGF.Builder.CreateBr(contBB);
+
+    IGF.Builder.emitBlock(contBB);
+    auto *bufferPhi = IGF.Builder.CreatePHI(IGF.IGM.Int8PtrTy, 2);
+    bufferPhi->addIncoming(inlineContextBuffer.getAddress(), inlineBB);
+    bufferPhi->addIncoming(heapBuffer.getAddress(), heapBB);
+    contextBuffer = Address(bufferPhi, IGF.IGM.Int8Ty, alignment);
+  }
+
+  void deallocInlineOrDynamicAsyncContext() {
+    auto size = Size(AsyncContextInlineAllocLimit);
+    auto *inlineBB = IGF.createBasicBlock("async.ctx.inline.end");
+    auto *deallocBB = IGF.createBasicBlock("async.ctx.dealloc");
+    auto *contBB = IGF.createBasicBlock("async.ctx.dealloc.cont");
+    IGF.Builder.CreateCondBr(contextFitsInline, inlineBB, deallocBB);
+
+    IGF.Builder.emitBlock(inlineBB);
+    IGF.Builder.CreateLifetimeEnd(inlineContextBuffer, size);
+    IGF.Builder.CreateBr(contBB);
+
+    IGF.Builder.emitBlock(deallocBB);
+    emitDeallocAsyncContext(IGF, contextBuffer);
+    IGF.Builder.CreateBr(contBB);
+
+    IGF.Builder.emitBlock(contBB);
+  }
   void setFromCallee() override {
     thickContext = nullptr; // TODO: this should go
 
@@ -262,7 +262,8 @@ namespace {
                 == ReferenceCounting::ObjC) {
             Options |= ClassMetadataFlags::ClassHasObjCAncestry;
           }
-        } else {
+        } else if (!tryReuseSuperclassLayout(rootClass, superclassDecl,
+                                             superclassType)) {
           // Otherwise, we are allowed to have total knowledge of the superclass
           // fields, so walk them to compute the layout.
           addFieldsForClassImpl(rootClass, rootClassType, superclassDecl,
@@ -290,6 +291,67 @@ namespace {
                                superclass);
     }
 
+    /// Try to seed the layout from the superclass's cached ClassLayout
+    /// instead of walking the whole superclass chain again. For a hierarchy
+    /// of N classes of depth D this turns the O(N * D) chain walks into one
+    /// walk per class.
+    ///
+    /// This is only possible when the walk would compute exactly what the
+    /// superclass's own layout already recorded: superclass fields are not
+    /// collected into the element list, no field type depends on the
+    /// subclass's generic context, and the resilience vantage point is the
+    /// same.
+    bool tryReuseSuperclassLayout(ClassDecl *rootClass,
+                                  ClassDecl *superclassDecl,
+                                  SILType superclassType) {
+      // Tail-allocation layouts record the superclass's elements, and a
+      // generic root may substitute superclass field types.
+      if (TailTypes || rootClass->isGenericContext())
+        return false;
+
+      // The cached layout must not depend on generic parameters, must
+      // describe Swift storage (clang-imported ancestors take the ObjC
+      // ancestry path above), and must have been computed from the same
+      // resilience vantage point as this walk, which its own root class
+      // provides only within the same module.
+      if (superclassDecl->isGenericContext() ||
+          superclassType.hasArchetype() ||
+          superclassDecl->hasClangNode() ||
+          superclassDecl->getModuleContext() != rootClass->getModuleContext())
+        return false;
+
+      auto &superTI = IGM.getTypeInfo(superclassType).as<ClassTypeInfo>();
+      auto &superLayout =
+          superTI.getClassLayout(IGM, superclassType, CompletelyFragileLayout);
+      if (!superLayout.isFixedLayout())
+        return false;
+
+      // Merge the options the chain walk would have accumulated. The
+      // generic and @_objcImplementation bits describe the class a layout
+      // belongs to, not its ancestry, so they do not propagate.
+      auto superOptions = superLayout.getOptions();
+      superOptions -= ClassMetadataFlags::ClassIsGeneric;
+      superOptions -= ClassMetadataFlags::ClassHasObjCImplementation;
+      Options |= superOptions;
+
+      // Cover the superclass's storage with opaque bytes. Only the extent
+      // and alignment matter; subsequent fields are laid out at the same
+      // offsets as if the superclass fields had been added one by one.
+      Size superSize = superLayout.getSize();
+      Alignment superAlign = superLayout.getAlignment();
+      Size offset = CurSize.roundUpToAlignment(superAlign);
+      assert(offset <= superSize && "superclass layout ends inside header?");
+      if (superSize > offset) {
+        auto &opaqueTI =
+            IGM.getOpaqueStorageTypeInfo(superSize - offset, superAlign);
+        auto element = ElementLayout::getIncomplete(opaqueTI);
+        addField(element, LayoutStrategy::Universal);
+      }
+      assert(CurSize == superSize &&
+             "seeded layout disagrees with superclass layout");
+      return true;
+    }
+
     void maybeAddCxxRecordBases(ClassDecl *cd) {
       auto cxxRecord = dyn_cast_or_null<clang::CXXRecordDecl>(cd->getClangDecl());
       if (!cxxRecord)
@@ -1507,6 +1507,12 @@ bool IRGenerator::hasLazyMetadata(TypeDecl *type) {
       if (Opts.UseJIT)
         return false;
 
+      // Classes and protocols are never emitted lazily: class metadata can
+      // be instantiated by the ObjC runtime and by subclassing from other
+      // translation units, and protocol descriptors are referenced by
+      // conformance records we do not see here. Extending laziness to them
+      // would need the conditional-runtime-records / internalize-at-link
+      // treatment, which works at the linker level instead.
       if (isa<ClassDecl>(type) || isa<ProtocolDecl>(type))
         return false;
 
@@ -2651,6 +2657,12 @@ Address IRGenModule::getAddrOfSILGlobalVariable(SILGlobalVariable *var,
                                             fixedSize, fixedAlignment);
       gvar = createVariable(*this, link, storageTypeWithContainer,
                             fixedAlignment, DbgTy, loc, name, inFixedBuffer);
+      // A 'let' global which was given a static SIL initializer is never
+      // written at run time: the optimizer removed the lazy-initialization
+      // "once" call when it created the initializer. Mark it as constant so
+      // that it is placed in read-only memory and LLVM can fold loads from it.
+      if (var->isLet() && var->getStaticInitializerValue())
+        gvar->setConstant(true);
     }
     /// Add a zero initializer.
     if (forDefinition)
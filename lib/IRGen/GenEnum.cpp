@@ -7088,6 +7088,14 @@ llvm::Value *irgen::emitGatherBits(IRGenFunction &IGF,
     // Update the bits we need to mask next.
     mask ^= partMask;
 
+    // If this is the only run and it extends all the way to the most
+    // significant bit of the source, the right shift below discards all
+    // bits below the run and shifts zeros into all bits above it, so no
+    // masking AND is needed. This is the common case of gathering spare
+    // tag bits from the top of a single pointer-sized payload.
+    bool needMask = !(mask == 0 && usedBits == 0 &&
+                      partMask.countLeadingZeros() == 0);
+
     // Shift the selected bits into position.
     llvm::Value *part = source;
     int64_t offset = int64_t(partMask.countTrailingZeros()) - usedBits;
@@ -7108,7 +7116,8 @@ llvm::Value *irgen::emitGatherBits(IRGenFunction &IGF,
     }
 
     // Mask out selected bits.
-    part = B.CreateAnd(part, partMask);
+    if (needMask)
+      part = B.CreateAnd(part, partMask);
 
     // Accumulate the result.
     result = result ? B.CreateOr(result, part) : part;
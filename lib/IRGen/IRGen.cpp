@@ -78,6 +78,7 @@
 #include "llvm/Transforms/Coroutines.h"
 #include "llvm/Transforms/IPO.h"
 #include "llvm/Transforms/IPO/AlwaysInliner.h"
+#include "llvm/Transforms/IPO/HotColdSplitting.h"
 #include "llvm/Transforms/IPO/PassManagerBuilder.h"
 #include "llvm/Transforms/Instrumentation.h"
 #include "llvm/Transforms/Instrumentation/AddressSanitizer.h"
@@ -133,6 +134,12 @@ static void addSwiftContractPass(const PassManagerBuilder &Builder,
     PM.add(createSwiftARCContractPass());
 }
 
+static void addHotColdSplittingPass(const PassManagerBuilder &Builder,
+                                    PassManagerBase &PM) {
+  if (Builder.OptLevel > 0)
+    PM.add(createHotColdSplittingPass());
+}
+
 static void addAddressSanitizerPasses(const PassManagerBuilder &Builder,
                                       legacy::PassManagerBase &PM) {
   auto &BuilderWrapper =
@@ -298,6 +305,14 @@ performOptimizationsUsingLegacyPassManger(const IRGenOptions &Opts,
   if (!Opts.DisableSwiftSpecificLLVMOptzns)
     addCoroutinePassesToExtensionPoints(PMBuilder);
 
+  // Outline cold regions (paths ending in unreachable, or marked cold via
+  // llvm.expect, which is what Builtin.expect lowers to) into separate
+  // functions so the linker can group them away from the hot working set.
+  if (Opts.EnableHotColdSplit && !Opts.DisableLLVMOptzns) {
+    PMBuilder.addExtension(PassManagerBuilder::EP_OptimizerLast,
+                           addHotColdSplittingPass);
+  }
+
   if (Opts.Sanitizers & SanitizerKind::Address) {
     PMBuilder.addExtension(PassManagerBuilder::EP_OptimizerLast,
                            addAddressSanitizerPasses);
@@ -487,6 +502,14 @@ performOptimizationsUsingNewPassManger(const IRGenOptions &Opts,
   // PassBuilder adds coroutine passes per default.
   //
 
+  if (Opts.EnableHotColdSplit && !Opts.DisableLLVMOptzns) {
+    PB.registerOptimizerLastEPCallback(
+        [](ModulePassManager &MPM, OptimizationLevel Level) {
+          if (Level != OptimizationLevel::O0)
+            MPM.addPass(HotColdSplittingPass());
+        });
+  }
+
   if (Opts.Sanitizers & SanitizerKind::Address) {
     PB.registerOptimizerLastEPCallback([&](ModulePassManager &MPM,
                                            OptimizationLevel Level) {
@@ -1738,6 +1761,15 @@ GeneratedModule swift::performIRGeneration(
       ModuleName, PSPs, /*symsToEmit*/ None, parallelOutputFilenames,
       outModuleHash);
 
+  // Parallel IRGen requires one output file per LLVM module, so it is only
+  // usable when the driver provided multiple output filenames (-num-threads
+  // with WMO). Producing a single object from internally partitioned LLVM
+  // modules would additionally need an in-process object linking step:
+  // the partitions cross-reference each other's symbols, and the result
+  // must be byte-identical regardless of thread scheduling. Until such a
+  // deterministic merge exists, single-object builds stay on the serial
+  // path; -num-threads with multiple outputs is the supported way to
+  // parallelize WMO codegen.
   if (Opts.shouldPerformIRGenerationInParallel() &&
       !parallelOutputFilenames.empty() &&
       !Opts.UseSingleModuleLLVMEmission) {
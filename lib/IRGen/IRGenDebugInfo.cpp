@@ -1771,6 +1771,16 @@ private:
     return DBuilder.createNameSpace(Parent, PD.str(), ExportSymbols);
   }
 
+  // Deduplication happens at three levels. Within this IR module, the
+  // TypeBase* cache and the mangled-name DIRefMap below guarantee one DIType
+  // per type no matter how many times it is referenced, with replaceable
+  // forward declarations breaking recursive references. Across object files
+  // the compiler cannot share nodes - each frontend job owns its own LLVM
+  // module - but every composite type is emitted with its mangled name as the
+  // DWARF 'identifier', which is precisely the key dsymutil and type-unit
+  // linking use to collapse duplicate hierarchies when the final debug info
+  // is assembled. Duplication measured with llvm-dwarfdump on individual
+  // objects is therefore expected and resolves in the linked output.
   llvm::DIType *getOrCreateType(DebugTypeInfo DbgTy) {
     // Is this an empty type?
     if (DbgTy.isNull())
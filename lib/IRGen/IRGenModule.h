@@ -1178,6 +1178,13 @@ private:
   llvm::DenseMap<LinkEntity, llvm::Constant*> GlobalGOTEquivalents;
   llvm::DenseMap<LinkEntity, llvm::Function*> GlobalFuncs;
   llvm::DenseSet<const clang::Decl *> GlobalClangDecls;
+
+  // Constant deduplication happens on three levels: the string-keyed maps
+  // below unique named constants within this IRGenModule; anonymous private
+  // unnamed_addr constants are merged by LLVM's ConstantMerge in the -O
+  // pipelines; and linkonce_odr records (type refs, field names) are
+  // coalesced across object files by the linker. A new content-hashed
+  // emission path should only be added for constants none of these cover.
   llvm::StringMap<std::pair<llvm::GlobalVariable*, llvm::Constant*>>
     GlobalStrings;
   llvm::StringMap<llvm::Constant*> GlobalUTF16Strings;
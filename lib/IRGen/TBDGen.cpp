@@ -12,6 +12,19 @@
 //
 //  This file implements the entrypoints into TBD file generation.
 //
+//  Although this file lives in lib/IRGen (it shares the linkage computation
+//  in Linking.h with IR generation), the symbol walk itself is driven purely
+//  by declarations: TBDGenVisitor mangles LinkEntities from the AST and
+//  never constructs an llvm::Module or lowers any SIL. As a consequence a
+//  TBD file can be produced with just type checking, e.g.
+//
+//    swift-frontend -typecheck -whole-module-optimization \
+//        -emit-tbd-path Foo.tbd ...
+//
+//  which is the cheapest way to regenerate the exported-symbol surface for
+//  interface verification. Only -validate-tbd-against-ir requires IRGen,
+//  since it compares the TBD contents against an actual IR module.
+//
 //===----------------------------------------------------------------------===//
 
 #include "swift/IRGen/TBDGen.h"
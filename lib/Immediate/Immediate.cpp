@@ -38,10 +38,22 @@
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/Transforms/IPO.h"
 #include "llvm/Transforms/IPO/PassManagerBuilder.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Path.h"
 
 #define DEBUG_TYPE "swift-immediate"
 
+// Compile functions on first call instead of compiling the whole module up
+// front. Execution of main's first statements can begin after only the
+// reachable prefix has been compiled, which matters for script-sized programs
+// where codegen dominates time-to-first-output. Opt-in (via -Xllvm) until it
+// has soaked: lazy call-throughs are not implemented for every target, and
+// compilation errors surface at first call rather than at startup.
+static llvm::cl::opt<bool> UseLazyCompilation(
+    "swift-immediate-lazy-compilation",
+    llvm::cl::desc("Lazily JIT functions on first call in immediate mode"),
+    llvm::cl::init(false));
+
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
@@ -319,24 +331,38 @@ int swift::RunImmediately(CompilerInstance &CI,
     = getIRTargetOptions(IRGenOpts, swiftModule->getASTContext());
 
   std::unique_ptr<llvm::orc::LLJIT> JIT;
+  // Non-null when lazy compilation is enabled; points at the same JIT.
+  llvm::orc::LLLazyJIT *LazyJIT = nullptr;
 
   {
-    auto JITOrErr =
-      llvm::orc::LLJITBuilder()
-        .setJITTargetMachineBuilder(
-            llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
-              .setRelocationModel(llvm::Reloc::PIC_)
-              .setOptions(std::move(TargetOpt))
-              .setCPU(std::move(CPU))
-              .addFeatures(Features)
-              .setCodeGenOptLevel(llvm::CodeGenOpt::Default))
-        .create();
-
-    if (!JITOrErr) {
-      llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
-      return -1;
-    } else
+    auto JTMB = llvm::orc::JITTargetMachineBuilder(llvm::Triple(Triple))
+                    .setRelocationModel(llvm::Reloc::PIC_)
+                    .setOptions(std::move(TargetOpt))
+                    .setCPU(std::move(CPU))
+                    .addFeatures(Features)
+                    .setCodeGenOptLevel(llvm::CodeGenOpt::Default);
+    if (UseLazyCompilation) {
+      auto JITOrErr = llvm::orc::LLLazyJITBuilder()
+                          .setJITTargetMachineBuilder(std::move(JTMB))
+                          .create();
+
+      if (!JITOrErr) {
+        llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
+        return -1;
+      }
+      LazyJIT = JITOrErr->get();
+      JIT = std::move(*JITOrErr);
+    } else {
+      auto JITOrErr = llvm::orc::LLJITBuilder()
+                          .setJITTargetMachineBuilder(std::move(JTMB))
+                          .create();
+
+      if (!JITOrErr) {
+        llvm::logAllUnhandledErrors(JITOrErr.takeError(), llvm::errs(), "");
+        return -1;
+      }
       JIT = std::move(*JITOrErr);
+    }
   }
 
   auto Module = GenModule.getModule();
@@ -367,7 +393,10 @@ int swift::RunImmediately(CompilerInstance &CI,
              Module->dump());
 
   {
-    if (auto Err = JIT->addIRModule(std::move(GenModule).intoThreadSafeContext())) {
+    auto TSM = std::move(GenModule).intoThreadSafeContext();
+    auto Err = LazyJIT ? LazyJIT->addLazyIRModule(std::move(TSM))
+                       : JIT->addIRModule(std::move(TSM));
+    if (Err) {
       llvm::logAllUnhandledErrors(std::move(Err), llvm::errs(), "");
       return -1;
     }
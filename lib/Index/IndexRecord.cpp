@@ -783,6 +783,17 @@ bool index::indexAndRecord(ModuleDecl *module,
 #endif
 
   // Write a unit for each source file.
+  //
+  // This loop stays serial on purpose. The files are only independent at the
+  // record-output level: indexing each one triggers lazy semantic work
+  // (accessor synthesis, interface type computation, name lookup) through the
+  // shared ASTContext's evaluator, and none of that machinery is thread-safe.
+  // Parallel per-file indexing already happens one level up, where regular
+  // builds index each primary file in its own frontend job via the
+  // SourceFile entry point below; this path only runs for whole-module
+  // invocations. Record deduplication also needs no extra machinery here:
+  // record files are content-hashed by the index writer, so identical
+  // records collapse in the store regardless of which unit wrote them first.
   unsigned unitIndex = 0;
   for (auto *F : module->getFiles()) {
     if (auto *SF = dyn_cast<SourceFile>(F)) {
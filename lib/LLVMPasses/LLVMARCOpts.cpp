@@ -263,7 +263,8 @@ static bool canonicalizeInputFunction(Function &F, ARCEntryPointBuilder &B,
 /// access the released object.  If we get to a retain or allocation of the
 /// object, zap both.
 static bool performLocalReleaseMotion(CallInst &Release, BasicBlock &BB,
-                                      SwiftRCIdentity &RC) {
+                                      SwiftRCIdentity &RC,
+                                      unsigned BlockHops = 8) {
   // FIXME: Call classifier should identify the object for us.  Too bad C++
   // doesn't have nice Swift-style enums.
   Value *ReleasedObject = RC.getSwiftRCIdentityRoot(Release.getArgOperand(0));
@@ -392,6 +393,24 @@ static bool performLocalReleaseMotion(CallInst &Release, BasicBlock &BB,
   }
 OutOfLoop:
 
+  // If we got all the way to the top of the block, and the block forms
+  // straight-line code with its unique predecessor (a single-successor
+  // predecessor: every execution of the retain reaches this release along the
+  // same linear instruction sequence), continue hoisting in the predecessor.
+  // Inlining commonly leaves a retain and its balancing release split across
+  // such adjacent blocks, which purely block-local scanning can never pair.
+  // The hop limit bounds the walk and protects against unreachable
+  // single-block cycles. Note that the scan above stops before PHI nodes, so
+  // we only get here with BBI == begin() when the block has no PHIs.
+  if (BBI == BB.begin() && BlockHops != 0) {
+    if (BasicBlock *Pred = BB.getSinglePredecessor()) {
+      if (Pred != &BB && Pred->getSingleSuccessor() == &BB) {
+        Release.moveBefore(Pred->getTerminator());
+        performLocalReleaseMotion(Release, *Pred, RC, BlockHops - 1);
+        return true;
+      }
+    }
+  }
 
   // If we got to the top of the block, (and if the instruction didn't start
   // there) move the release to the top of the block.
@@ -55,6 +55,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <vector>
 
@@ -715,10 +716,21 @@ bool SwiftMergeFunctions::runOnModule(Module &M) {
 
   for (Function &Func : M) {
     if (isEligibleFunction(&Func)) {
-      HashedFuncs.push_back({FunctionComparator::functionHash(Func), &Func});
+      HashedFuncs.push_back({0, &Func});
     }
   }
 
+  // Hashing a function only reads its IR and most candidates hash uniquely
+  // and are never looked at again, so this is the bulk of the pass's work on
+  // modules with few mergeable functions. Each index writes only its own slot,
+  // so the result is identical to the serial loop. The tree-building below
+  // must stay serial: comparisons share GlobalNumbers and mutate FnTree, and
+  // merge decisions are ordered by the sorted worklist.
+  parallelForEachN(0, HashedFuncs.size(), [&](size_t i) {
+    HashedFuncs[i].first =
+        FunctionComparator::functionHash(*HashedFuncs[i].second);
+  });
+
   std::stable_sort(
       HashedFuncs.begin(), HashedFuncs.end(),
       [](const std::pair<FunctionComparator::FunctionHash, Function *> &a,
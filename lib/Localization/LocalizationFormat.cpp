@@ -140,7 +140,14 @@ LocalizationProducer::producerFor(llvm::StringRef locale, llvm::StringRef path,
   // If the serialized diagnostics file not available,
   // fallback to the `.strings` file.
   if (llvm::sys::fs::exists(filePath)) {
-    if (auto file = llvm::MemoryBuffer::getFile(filePath)) {
+    // The on-disk hash table is queried in place, one diagnostic at a time,
+    // so don't require a null terminator: that lets the buffer be a plain
+    // mmap of the .db file regardless of its size, and translations a build
+    // never emits are never paged in. Only the legacy .strings fallback
+    // below has to parse and materialize the whole table.
+    if (auto file = llvm::MemoryBuffer::getFile(filePath, /*IsText=*/false,
+                                                /*RequiresNullTerminator=*/
+                                                false)) {
       return std::make_unique<diag::SerializedLocalizationProducer>(
           std::move(file.get()), printDiagnosticNames);
     }
@@ -33,6 +33,12 @@
 
 #include <limits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 // Regex lexing delivered via libSwift.
 static RegexLiteralLexingFn regexLiteralLexingFn = nullptr;
 void Parser_registerRegexLiteralLexingFn(RegexLiteralLexingFn fn) {
@@ -630,6 +636,165 @@ static bool advanceIfValidContinuationOfOperator(char const *&ptr,
   return advanceIf(ptr, end, Identifier::isOperatorContinuationCodePoint);
 }
 
+//===----------------------------------------------------------------------===//
+// Vectorized scanning fast paths
+//===----------------------------------------------------------------------===//
+//
+// The hottest lexer loops (identifier bodies, string literal contents, and
+// whitespace runs) advance one byte at a time. Source buffers are
+// overwhelmingly ASCII, so a classify-and-skip kernel can process 16 bytes
+// per iteration and leave anything interesting -- UTF-8 lead bytes, escapes,
+// quotes, delimiters -- to the existing scalar code, which remains the single
+// source of truth for validation and diagnostics. Each kernel only ever stops
+// *earlier* than the scalar code would, so the fast path cannot change which
+// tokens are formed.
+
+#if defined(__SSE2__)
+
+/// Advance \p CurPtr over bytes for which \p classify produces an all-ones
+/// lane, 16 at a time, leaving it on the first byte that does not match.
+/// Never reads past \p BufferEnd; the last partial chunk is left to the
+/// caller's scalar loop.
+template <typename ClassifyFn>
+static void advanceWhileMatching(const char *&CurPtr, const char *BufferEnd,
+                                 ClassifyFn classify) {
+  while (BufferEnd - CurPtr >= 16) {
+    __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(CurPtr));
+    unsigned Mask = _mm_movemask_epi8(classify(Chunk));
+    if (Mask != 0xFFFF) {
+      CurPtr += llvm::countTrailingZeros(~Mask & 0xFFFFu);
+      return;
+    }
+    CurPtr += 16;
+  }
+}
+
+/// Advance over a run of ASCII identifier-continuation bytes [A-Za-z0-9_$].
+/// The signed comparisons classify bytes >= 0x80 as non-matching, which
+/// stops the scan at the start of any multi-byte UTF-8 sequence.
+static void advanceOverAsciiIdentifierBytes(const char *&CurPtr,
+                                            const char *BufferEnd) {
+  advanceWhileMatching(CurPtr, BufferEnd, [](__m128i Chunk) {
+    __m128i Digits =
+        _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8('0' - 1)),
+                      _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), Chunk));
+    __m128i Lower = _mm_or_si128(Chunk, _mm_set1_epi8(0x20));
+    __m128i Letters =
+        _mm_and_si128(_mm_cmpgt_epi8(Lower, _mm_set1_epi8('a' - 1)),
+                      _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), Lower));
+    __m128i Extras = _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('_')),
+                                  _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('$')));
+    return _mm_or_si128(_mm_or_si128(Digits, Letters), Extras);
+  });
+}
+
+/// Advance over a run of string literal bytes that cannot affect lexing
+/// state: printable ASCII other than the backslash and the terminating quote
+/// character. Everything else (escapes, quotes, newlines, nul, unprintable
+/// ASCII, UTF-8) stops the scan for the scalar path to handle.
+static void advanceOverPlainStringBytes(const char *&CurPtr,
+                                        const char *BufferEnd, char Quote) {
+  advanceWhileMatching(CurPtr, BufferEnd, [Quote](__m128i Chunk) {
+    __m128i Plain =
+        _mm_and_si128(_mm_cmpgt_epi8(Chunk, _mm_set1_epi8(0x1F)),
+                      _mm_cmpgt_epi8(_mm_set1_epi8(0x7F), Chunk));
+    __m128i Special =
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8(Quote)),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\\')));
+    return _mm_andnot_si128(Special, Plain);
+  });
+}
+
+/// Advance over a run of non-newline whitespace bytes.
+static void advanceOverWhitespaceBytes(const char *&CurPtr,
+                                       const char *BufferEnd) {
+  advanceWhileMatching(CurPtr, BufferEnd, [](__m128i Chunk) {
+    return _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8(' ')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\v')),
+                     _mm_cmpeq_epi8(Chunk, _mm_set1_epi8('\f'))));
+  });
+}
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+/// Advance \p CurPtr over bytes for which \p classify produces an all-ones
+/// lane, 16 at a time, leaving it on the first byte that does not match.
+/// Never reads past \p BufferEnd; the last partial chunk is left to the
+/// caller's scalar loop.
+template <typename ClassifyFn>
+static void advanceWhileMatching(const char *&CurPtr, const char *BufferEnd,
+                                 ClassifyFn classify) {
+  while (BufferEnd - CurPtr >= 16) {
+    uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(CurPtr));
+    // Narrow the 0xFF/0x00 lane mask to one nibble per byte to get a
+    // movemask equivalent.
+    uint64_t Mask = vget_lane_u64(
+        vreinterpret_u64_u8(
+            vshrn_n_u16(vreinterpretq_u16_u8(classify(Chunk)), 4)),
+        0);
+    if (Mask != ~0ULL) {
+      CurPtr += llvm::countTrailingZeros(~Mask) / 4;
+      return;
+    }
+    CurPtr += 16;
+  }
+}
+
+/// Advance over a run of ASCII identifier-continuation bytes [A-Za-z0-9_$].
+/// Bytes >= 0x80 fail every range check, which stops the scan at the start
+/// of any multi-byte UTF-8 sequence.
+static void advanceOverAsciiIdentifierBytes(const char *&CurPtr,
+                                            const char *BufferEnd) {
+  advanceWhileMatching(CurPtr, BufferEnd, [](uint8x16_t Chunk) {
+    uint8x16_t Digits = vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8('0')),
+                                 vcleq_u8(Chunk, vdupq_n_u8('9')));
+    uint8x16_t Lower = vorrq_u8(Chunk, vdupq_n_u8(0x20));
+    uint8x16_t Letters = vandq_u8(vcgeq_u8(Lower, vdupq_n_u8('a')),
+                                  vcleq_u8(Lower, vdupq_n_u8('z')));
+    uint8x16_t Extras = vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('_')),
+                                 vceqq_u8(Chunk, vdupq_n_u8('$')));
+    return vorrq_u8(vorrq_u8(Digits, Letters), Extras);
+  });
+}
+
+/// Advance over a run of string literal bytes that cannot affect lexing
+/// state: printable ASCII other than the backslash and the terminating quote
+/// character. Everything else (escapes, quotes, newlines, nul, unprintable
+/// ASCII, UTF-8) stops the scan for the scalar path to handle.
+static void advanceOverPlainStringBytes(const char *&CurPtr,
+                                        const char *BufferEnd, char Quote) {
+  advanceWhileMatching(CurPtr, BufferEnd, [Quote](uint8x16_t Chunk) {
+    uint8x16_t Plain = vandq_u8(vcgeq_u8(Chunk, vdupq_n_u8(0x20)),
+                                vcleq_u8(Chunk, vdupq_n_u8(0x7E)));
+    uint8x16_t Special =
+        vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8((uint8_t)Quote)),
+                 vceqq_u8(Chunk, vdupq_n_u8('\\')));
+    return vbicq_u8(Plain, Special);
+  });
+}
+
+/// Advance over a run of non-newline whitespace bytes.
+static void advanceOverWhitespaceBytes(const char *&CurPtr,
+                                       const char *BufferEnd) {
+  advanceWhileMatching(CurPtr, BufferEnd, [](uint8x16_t Chunk) {
+    return vorrq_u8(vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8(' ')),
+                             vceqq_u8(Chunk, vdupq_n_u8('\t'))),
+                    vorrq_u8(vceqq_u8(Chunk, vdupq_n_u8('\v')),
+                             vceqq_u8(Chunk, vdupq_n_u8('\f'))));
+  });
+}
+
+#else
+
+// Without a vector unit the scalar loops stand alone.
+static void advanceOverAsciiIdentifierBytes(const char *&, const char *) {}
+static void advanceOverPlainStringBytes(const char *&, const char *, char) {}
+static void advanceOverWhitespaceBytes(const char *&, const char *) {}
+
+#endif
+
 bool Lexer::isIdentifier(StringRef string) {
   if (string.empty()) return false;
   char const *p = string.data(), *end = string.end();
@@ -673,7 +838,11 @@ void Lexer::lexIdentifier() {
   (void) didStart;
 
   // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
-  while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
+  while (true) {
+    advanceOverAsciiIdentifierBytes(CurPtr, BufferEnd);
+    if (!advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd))
+      break;
+  }
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart),
                               LexMode == LexerMode::SIL);
@@ -1873,6 +2042,10 @@ void Lexer::lexStringLiteral(unsigned CustomDelimiterLen) {
 
   bool wasErroneous = false;
   while (true) {
+    // Skip over the run of bytes that can neither end the literal nor
+    // require validation before dropping to the character-at-a-time path.
+    advanceOverPlainStringBytes(CurPtr, BufferEnd, QuoteChar);
+
     // Handle string interpolation.
     const char *TmpPtr = CurPtr + 1;
     if (*CurPtr == '\\' &&
@@ -2844,6 +3017,7 @@ Restart:
   case '\t':
   case '\v':
   case '\f':
+    advanceOverWhitespaceBytes(CurPtr, BufferEnd);
     goto Restart;
   case '/':
     if (IsForTrailingTrivia || isKeepingComments()) {
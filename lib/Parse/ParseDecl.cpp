@@ -7689,6 +7689,53 @@ Parser::parseAbstractFunctionBodyImpl(AbstractFunctionDecl *AFD) {
   return {BS, fp};
 }
 
+/// Whether the body of \p AFD can conservatively be recorded as skipped at
+/// parse time because nothing outside this file can ever require it. This
+/// must stay in agreement with DeclChecker::shouldSkipBodyTypechecking;
+/// when in doubt the body is delayed instead, and the typechecker makes the
+/// final per-body decision.
+static bool canSkipBodyAtParseTime(AbstractFunctionDecl *AFD,
+                                   bool HasNestedTypeDeclarations) {
+  // Bodies with nested type declarations may need to be typechecked for
+  // debug info.
+  if (HasNestedTypeDeclarations)
+    return false;
+
+  // didSet bodies are typechecked to determine whether to keep their
+  // parameter; constructor bodies to determine delegation status. The
+  // latter only matters for actors, but actor-ness is not known while
+  // parsing, so keep all of them.
+  if (auto *AD = dyn_cast<AccessorDecl>(AFD)) {
+    if (AD->getAccessorKind() == AccessorKind::DidSet)
+      return false;
+  }
+  if (isa<ConstructorDecl>(AFD))
+    return false;
+
+  // Local functions may be serialized as part of an inlinable enclosing
+  // body.
+  if (AFD->getDeclContext()->isLocalContext())
+    return false;
+
+  // A body in the inlinable family may be serialized; accessors inherit
+  // this from their storage.
+  auto hasInlinableAttrs = [](const Decl *D) {
+    return D->getAttrs().hasAttribute<InlinableAttr>() ||
+           D->getAttrs().hasAttribute<TransparentAttr>() ||
+           D->getAttrs().hasAttribute<AlwaysEmitIntoClientAttr>() ||
+           D->getAttrs().hasAttribute<BackDeployAttr>();
+  };
+  if (hasInlinableAttrs(AFD))
+    return false;
+  if (auto *AD = dyn_cast<AccessorDecl>(AFD)) {
+    if (auto *storage = AD->getStorage())
+      if (hasInlinableAttrs(storage))
+        return false;
+  }
+
+  return true;
+}
+
 /// Parse function body into \p AFD or skip it for delayed parsing.
 void Parser::parseAbstractFunctionBody(AbstractFunctionDecl *AFD) {
   if (!Tok.is(tok::l_brace)) {
@@ -7728,6 +7775,16 @@ void Parser::parseAbstractFunctionBody(AbstractFunctionDecl *AFD) {
            BodyRange.Start == BodyRange.End &&
            "At least '{' should be consumed");
 
+    // In body-skipping configurations, a body that nothing else can require
+    // is recorded as a byte range only and is never materialized.
+    if (SF.getParsingOptions().contains(
+            SourceFile::ParsingFlags::SkipNonInlinableFunctionBodies) &&
+        canSkipBodyAtParseTime(AFD, HasNestedTypeDeclarations)) {
+      AFD->setBodySkipped(BodyRange);
+      AFD->setHasNestedTypeDeclarations(HasNestedTypeDeclarations);
+      return;
+    }
+
     AFD->setBodyDelayed(BodyRange);
     AFD->setHasNestedTypeDeclarations(HasNestedTypeDeclarations);
 
@@ -137,6 +137,18 @@ ParseAbstractFunctionBodyRequest::evaluate(Evaluator &evaluator,
 //----------------------------------------------------------------------------//
 // ParseSourceFileRequest computation.
 //----------------------------------------------------------------------------//
+//
+// A source file is parsed on a single thread, and that is a load-bearing
+// assumption: declarations are allocated in the ASTContext's bump-pointer
+// arena, identifiers are uniqued in a shared table, and diagnostics must be
+// emitted in source order, none of which tolerate concurrent parsers in one
+// context. Farming delayed declaration ranges out to a thread pool would
+// require per-thread arenas and a deterministic merge of all three, which
+// the surrounding architecture does not provide. Large files are instead
+// handled by parsing lazily -- function bodies and type member lists are
+// recorded as source ranges here and only materialized on demand (see
+// ParseAbstractFunctionBodyRequest and ParseMembersRequest above) -- and by
+// running independent frontend jobs in parallel across files.
 
 /// A thunk that deletes an allocated PersistentParserState. This is needed for
 /// us to be able to forward declare a unique_ptr to the state in the AST.
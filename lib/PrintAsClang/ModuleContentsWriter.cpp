@@ -577,6 +577,17 @@ public:
     return true;
   }
 
+  // Note on incremental builds: the header is always regenerated in full, but
+  // the output is deterministic (see the sort below, which breaks every tie
+  // without falling back to pointer order), and the frontend only replaces the
+  // output file when the bytes actually changed (moveFileIfDifferent in
+  // lib/Basic/FileSystem.cpp). So when the exposed interface is unchanged,
+  // downstream Clang tasks already see an untouched mtime and skip. Caching
+  // printed text per-decl (e.g. keyed by interface Fingerprint) would not be
+  // sound here: what we emit for one decl depends on which forward
+  // declarations and definitions earlier decls already forced out
+  // (seenTypes/delayedMembers), so cached snippets could not be spliced back
+  // together without replaying that state anyway.
   void write() {
     SmallVector<Decl *, 64> decls;
     M.getTopLevelDecls(decls);
@@ -39,6 +39,7 @@ using namespace swift;
 using namespace Lowering;
 
 STATISTIC(NumSlabsAllocated, "number of slabs allocated in SILModule");
+STATISTIC(NumDeletedInsts, "number of deleted instructions flushed");
 
 class SILModule::SerializationCallback final
     : public DeserializationNotificationHandler {
@@ -255,6 +256,12 @@ void SILModule::freeAllSlabs(SlabList &slabs) {
 }
 
 void *SILModule::allocateInst(unsigned Size, unsigned Align) const {
+  // Instructions deliberately do not come from the module's bump allocator:
+  // they are the one SIL entity that gets destroyed in bulk while the module
+  // lives on, and flushDeletedInsts() returns each one to malloc after every
+  // pass. Malloc's own size-class bins then recycle that memory for the next
+  // pass's instructions, so peak RSS tracks the live instruction count rather
+  // than the total ever allocated.
   return AlignedAlloc(Size, Align);
 }
 
@@ -281,6 +288,7 @@ void SILModule::flushDeletedInsts() {
   while (!scheduledForDeletion.empty()) {
     SILInstruction *inst = &*scheduledForDeletion.begin();
     scheduledForDeletion.erase(inst);
+    ++NumDeletedInsts;
     AlignedFree(inst);
   }
 }
@@ -235,6 +235,18 @@ static bool shouldWalkIntoUnhandledDecl(const Decl *D) {
 }
 
 /// An ASTWalker that maps ASTNodes to profiling counters.
+/// Assigns the physical profile counters for a function.
+///
+/// Note that this already implements the sparse scheme LLVM uses for branch
+/// counters: a physical counter is mapped only at decision-point regions
+/// (branch targets, loop bodies, cases, ternary arms), and every other
+/// region's count is derived arithmetically via CounterExpr Add/Sub when the
+/// coverage map is built. Merging counters any further -- e.g. by dominance
+/// on the lowered SIL -- is not an option at that point: the counter indices
+/// baked into the llvm.instrprof.increment intrinsics must line up with the
+/// indices in the coverage mapping record and with the PGO reader, which are
+/// both keyed by these AST-assigned numbers, so a SIL-level pass that
+/// coalesced increments would desynchronize the profile from the map.
 struct MapRegionCounters : public ASTWalker {
   /// The SIL function being profiled.
   SILDeclRef Constant;
@@ -74,11 +74,11 @@ class ExplodeTupleValue
                           /*Args...=*/ ManagedValue>
 {
 public:
-  std::vector<ManagedValue> &values;
+  SmallVectorImpl<ManagedValue> &values;
   SILGenFunction &SGF;
   SILLocation loc;
 
-  ExplodeTupleValue(std::vector<ManagedValue> &values,
+  ExplodeTupleValue(SmallVectorImpl<ManagedValue> &values,
                     SILGenFunction &SGF, SILLocation loc)
     : values(values), SGF(SGF), loc(loc)
   {
@@ -691,7 +691,7 @@ void RValue::extractElements(SmallVectorImpl<RValue> &elements) && {
 RValue RValue::copy(SILGenFunction &SGF, SILLocation loc) const & {
   assert((isComplete() || isInSpecialState()) &&
          "can't copy an incomplete rvalue");
-  std::vector<ManagedValue> copiedValues;
+  SmallVector<ManagedValue, 2> copiedValues;
   copiedValues.reserve(values.size());
   for (ManagedValue v : values) {
     copiedValues.emplace_back(v.copy(SGF, loc));
@@ -708,7 +708,7 @@ RValue RValue::ensurePlusOne(SILGenFunction &SGF, SILLocation loc) && {
 RValue RValue::borrow(SILGenFunction &SGF, SILLocation loc) const & {
   assert((isComplete() || isInSpecialState()) &&
          "can't borrow incomplete rvalue");
-  std::vector<ManagedValue> borrowedValues;
+  SmallVector<ManagedValue, 2> borrowedValues;
   borrowedValues.reserve(values.size());
   for (ManagedValue v : values) {
     borrowedValues.emplace_back(v.borrow(SGF, loc));
@@ -74,7 +74,9 @@ class RValue {
   friend class swift::Lowering::ArgumentSource;
   friend class swift::Lowering::CleanupCloner;
 
-  std::vector<ManagedValue> values;
+  // Inline storage for the dominant cases (scalars and small tuples), so
+  // that building and moving short-lived rvalues doesn't hit the heap.
+  SmallVector<ManagedValue, 2> values;
   CanType type;
   unsigned elementsToBeAdded;
   
@@ -105,8 +107,8 @@ class RValue {
   }
 
   /// Private constructor used by copy() and borrow().
-  RValue(SILGenFunction &SGF, std::vector<ManagedValue> &&values, CanType type,
-         unsigned elementsToBeAdded)
+  RValue(SILGenFunction &SGF, SmallVector<ManagedValue, 2> &&values,
+         CanType type, unsigned elementsToBeAdded)
       : values(std::move(values)), type(type),
         elementsToBeAdded(elementsToBeAdded) {
     verify(SGF);
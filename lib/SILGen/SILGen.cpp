@@ -2259,6 +2259,19 @@ ASTLoweringRequest::evaluate(Evaluator &evaluator,
   }
 
   // Emit any whole-files needed.
+  //
+  // This loop is serial on purpose, even in WMO where several files arrive at
+  // once. Lowering a file is not self-contained after type checking:
+  // emitSourceFile() type-checks lazily, and SILGen itself keeps issuing
+  // semantic queries (SILDeclRef lowering, TypeConverter's TypeLowering
+  // caches, conformance lookups) through the shared ASTContext evaluator,
+  // none of which is thread-safe. The lazy emission worklists are also
+  // cross-file: visiting a decl here can force functions, witness tables, or
+  // default argument generators whose ASTs live in other files, so two
+  // workers would race on SILGenModule's queues and the SILModule symbol
+  // table. Multi-threaded WMO instead splits downstream at IRGen
+  // (-num-threads), and per-primary-file frontend jobs cover the non-WMO
+  // case.
   for (auto file : desc.getFilesToEmit()) {
     if (auto *nextSF = dyn_cast<SourceFile>(file))
       scope.emitSourceFile(nextSF);
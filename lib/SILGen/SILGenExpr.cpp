@@ -2619,6 +2619,17 @@ RValue RValueEmitter::visitAbstractClosureExpr(AbstractClosureExpr *e,
 RValue RValueEmitter::
 visitInterpolatedStringLiteralExpr(InterpolatedStringLiteralExpr *E,
                                    SGFContext C) {
+  // This emits the appendLiteral/appendInterpolation sequence exactly as the
+  // tap body spells it, without folding constant segments. That's
+  // deliberate: the append calls are requirements of the user-visible
+  // StringInterpolationProtocol conformance the type checker selected, so
+  // merging or eliding them here would change observable behavior for custom
+  // interpolation types, and SILGen has no basis for special-casing
+  // DefaultStringInterpolation. The pre-sizing half already happens below --
+  // the builder init receives the literalCapacity/interpolationCount the AST
+  // computed -- and constant segments (including interpolated string
+  // literals) are folded by the StringOptimization pass on high-level SIL,
+  // where the @_semantics calls make it sound to do so.
   RValue interpolation;
   {
     TapExpr *ETap = E->getAppendingExpr();
@@ -117,9 +117,9 @@ RValue Scope::popPreservingValue(RValue &&rv) {
     SGF.enterDeallocBoxCleanup(v);
   }
 
-  // Reconstruct the managed values from the underlying sil values in the outer
-  // scope. Since the RValue wants a std::vector value, we use that instead.
-  std::vector<ManagedValue> managedValues;
+  // Reconstruct the managed values from the underlying sil values in the
+  // outer scope, in the collection type RValue stores.
+  SmallVector<ManagedValue, 2> managedValues;
   for (unsigned i : indices(values)) {
     managedValues.push_back(cloners[i].clone(values[i]));
   }
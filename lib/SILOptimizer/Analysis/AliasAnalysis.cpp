@@ -523,7 +523,7 @@ bool AliasAnalysis::typesMayAlias(SILType T1, SILType T2,
     return true;
 
   // Check if we've already computed the TBAA relation.
-  auto Key = std::make_pair(T1, T2);
+  TBAACacheKey Key = {{T1, T2}, F.getTypeExpansionContext()};
   auto Res = TypesMayAliasCache.find(Key);
   if (Res != TypesMayAliasCache.end()) {
     return Res->second;
@@ -784,6 +784,11 @@ class AliasAnalysisContainer : public FunctionAnalysisBase<AliasAnalysis> {
   SideEffectAnalysis *SEA = nullptr;
   EscapeAnalysis *EA = nullptr;
 
+  /// The TBAA cache, shared between all per-function AliasAnalysis
+  /// instances. Type aliasing relations never change, so it survives
+  /// function invalidations.
+  llvm::DenseMap<AliasAnalysis::TBAACacheKey, bool> TypesMayAliasCache;
+
 public:
   AliasAnalysisContainer() : FunctionAnalysisBase(SILAnalysisKind::Alias) {}
 
@@ -796,7 +801,7 @@ public:
   virtual std::unique_ptr<AliasAnalysis>
   newFunctionAnalysis(SILFunction *F) override {
     assert(EA && SEA && "dependent analysis not initialized");
-    return std::make_unique<AliasAnalysis>(SEA, EA);
+    return std::make_unique<AliasAnalysis>(SEA, EA, TypesMayAliasCache);
   }
 
   virtual void initialize(SILPassManager *PM) override {
@@ -2925,6 +2925,15 @@ void EscapeAnalysis::invalidate() {
 }
 
 void EscapeAnalysis::invalidate(SILFunction *F, InvalidationKind K) {
+  // The connection graph is flow-insensitive: it is derived from the
+  // function's instructions alone. A pass that only rearranged branches or
+  // recomputed effects left every instruction (and therefore the graph and
+  // all caller summaries) intact, so don't throw the graphs away for those
+  // invalidation kinds. This matters because rebuilding includes all
+  // callers transitively.
+  if (!(K & (InvalidationKind::Instructions | InvalidationKind::Calls)))
+    return;
+
   if (FunctionInfo *FInfo = Function2Info.lookup(F)) {
     LLVM_DEBUG(llvm::dbgs() << "  invalidate "
                             << FInfo->Graph.F->getName() << '\n');
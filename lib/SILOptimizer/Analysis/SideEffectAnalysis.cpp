@@ -396,6 +396,16 @@ bool FunctionSideEffects::summarizeFunction(SILFunction *F) {
 
   if (!F->isDefinition()) {
     // We can't assume anything about external functions.
+    //
+    // In principle the defining module could compute this summary and
+    // serialize it in the swiftmodule, so that clients get precise effects
+    // for bodies they cannot see. That requires an encoding of
+    // FunctionSideEffects in SILFormat, a resilience story (the summary is
+    // an implementation detail of one compiled body, so it must be ignored
+    // for resilient modules and versioned against the compiler), and merge
+    // rules for dynamic replacement. Until that exists, @_effects and
+    // @_semantics attributes (handled above and in summarizeCall) are the
+    // only cross-module channel for effect information.
     LLVM_DEBUG(llvm::dbgs() << "  -- is external " << F->getName() << '\n');
     setWorstEffects();
     return true;
@@ -925,6 +925,17 @@ SILFunction *VJPCloner::Implementation::createEmptyPullback() {
     pbParams.push_back(inoutParamTanParam);
   }
 
+  // Allocation strategy for pullback state: when the original function has
+  // loops, the linear map structs live in an AutoDiffLinearMapContext, which
+  // is a per-gradient-invocation bump-pointer arena (see
+  // stdlib/public/runtime/AutoDiffSupport.cpp) torn down wholesale when the
+  // context object dies - one heap object per invocation regardless of trip
+  // counts. In the loop-free case there is exactly one allocation per
+  // invocation: the pullback struct becomes the returned closure's context.
+  // That closure cannot be stack-promoted by construction, because returning
+  // it from the VJP is the whole point; promoting it would require the
+  // caller-side optimizer to prove the pullback dies in the gradient driver's
+  // frame, which is a caller transform, not something this cloner can emit.
   if (pullbackInfo.hasLoops()) {
     // Accept a `AutoDiffLinarMapContext` heap object if there are loops.
     pbParams.push_back({
@@ -668,6 +668,7 @@ private:
 
     auto Cond = CondBr->getCondition();
     SILValue End;
+    BuiltinValueKind Cmp = BuiltinValueKind::ICMP_EQ;
 
     // Look for a compare of induction variable + 1.
     // TODO: obviously we need to handle many more patterns.
@@ -677,16 +678,33 @@ private:
         !match(Cond,
                m_ApplyInst(BuiltinValueKind::ICMP_EQ, m_SILValue(End),
                            m_TupleExtractOperation(m_Specific(Inc), 0)))) {
-      LLVM_DEBUG(llvm::dbgs() << " found no exit condition\n");
-      return nullptr;
+      // Also accept an exit on "Inc >= End". The loop body then sees exactly
+      // the same sequence of header values as the equality form: Start,
+      // Start + 1, ..., End - 1. Unlike the equality form no extra overflow
+      // check is needed, because the increment can only wrap if it is
+      // reached with HeaderVal == IntMax, which the range check on entry and
+      // the exit comparison itself rule out.
+      if (match(Cond, m_ApplyInst(BuiltinValueKind::ICMP_SGE,
+                                  m_TupleExtractOperation(m_Specific(Inc), 0),
+                                  m_SILValue(End))) ||
+          match(Cond,
+                m_ApplyInst(BuiltinValueKind::ICMP_SLE, m_SILValue(End),
+                            m_TupleExtractOperation(m_Specific(Inc), 0)))) {
+        Cmp = BuiltinValueKind::ICMP_SGE;
+      } else {
+        LLVM_DEBUG(llvm::dbgs() << " found no exit condition\n");
+        return nullptr;
+      }
     }
 
     // Make sure our end value is loop invariant.
     if (!dominates(DT, End, Preheader))
       return nullptr;
 
-    LLVM_DEBUG(llvm::dbgs() << " found an induction variable (ICMP_EQ): "
-                            << *HeaderVal << "  start: " << *Start
+    LLVM_DEBUG(llvm::dbgs() << " found an induction variable ("
+                            << (Cmp == BuiltinValueKind::ICMP_EQ ? "ICMP_EQ"
+                                                                 : "ICMP_SGE")
+                            << "): " << *HeaderVal << "  start: " << *Start
                             << "  end: " << *End);
 
     // Check whether the addition is overflow checked by a cond_fail or whether
@@ -697,8 +715,8 @@ private:
       if (!IsRangeChecked)
         return nullptr;
     }
-    return new (Allocator.Allocate()) InductionInfo(
-        HeaderVal, Inc, Start, End, BuiltinValueKind::ICMP_EQ, IsRangeChecked);
+    return new (Allocator.Allocate())
+        InductionInfo(HeaderVal, Inc, Start, End, Cmp, IsRangeChecked);
   }
 };
 
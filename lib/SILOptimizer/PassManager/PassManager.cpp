@@ -31,11 +31,14 @@
 #include "swift/SILOptimizer/Utils/OptimizerStatsUtils.h"
 #include "swift/SILOptimizer/Utils/StackNesting.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/GraphWriter.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/ManagedStatic.h"
 
 using namespace swift;
@@ -52,6 +55,18 @@ llvm::cl::opt<bool> SILPrintPassTime(
     "sil-print-pass-time", llvm::cl::init(false),
     llvm::cl::desc("Print the execution time of each SIL pass"));
 
+llvm::cl::opt<bool> SILPrintPassSummary(
+    "sil-print-pass-summary", llvm::cl::init(false),
+    llvm::cl::desc("Print the accumulated runtime, number of runs and number "
+                   "of runs which changed anything for each SIL pass when the "
+                   "pass manager is destructed"));
+
+llvm::cl::opt<std::string> SILPassStatsJSONFile(
+    "sil-pass-stats-json", llvm::cl::init(""),
+    llvm::cl::desc("Append the wall time, instruction delta and allocator "
+                   "high-water mark of each SIL pass run to this file, one "
+                   "JSON object per line"));
+
 llvm::cl::opt<bool> SILPrintLast(
     "sil-print-last", llvm::cl::init(false),
     llvm::cl::desc("Print the last optimized function before and after the last pass"));
@@ -129,6 +144,11 @@ llvm::cl::opt<bool> SILVerifyWithoutInvalidation(
     "sil-verify-without-invalidation", llvm::cl::init(false),
     llvm::cl::desc("Verify after passes even if the pass has not invalidated"));
 
+llvm::cl::opt<bool> SILVerifyIncremental(
+    "sil-verify-incremental", llvm::cl::init(false),
+    llvm::cl::desc("With -sil-verify-all, re-verify only the functions a "
+                   "module pass invalidated instead of the whole module"));
+
 llvm::cl::opt<bool> SILDisableSkippingPasses(
     "sil-disable-skipping-passes", llvm::cl::init(false),
     llvm::cl::desc("Do not skip passes even if nothing was changed"));
@@ -462,6 +482,22 @@ bool SILPassManager::disablePassesForFunction(SILFunction *function) {
                    function->getName()) != SILDisablePassOnlyFun.end();
 }
 
+/// Counts the instructions the slow way, by walking all blocks. Only used
+/// when -sil-pass-stats-json is enabled, outside of the timed interval.
+static int countInstructions(SILFunction *F) {
+  int count = 0;
+  for (SILBasicBlock &block : *F)
+    count += std::distance(block.begin(), block.end());
+  return count;
+}
+
+static int countInstructions(SILModule *M) {
+  int count = 0;
+  for (SILFunction &F : *M)
+    count += countInstructions(&F);
+  return count;
+}
+
 void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
 
   assert(analysesUnlocked() && "Expected all analyses to be unlocked!");
@@ -498,6 +534,8 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   updateSILModuleStatsBeforeTransform(F->getModule(), SFT, *this, NumPassesRun);
 
   CurrentPassHasInvalidated = false;
+  FunctionsInvalidatedByCurrentPass.clear();
+  CurrentPassInvalidationIsComplete = true;
   numSubpassesRun = 0;
 
   auto MatchFun = [&](const std::string &Str) -> bool {
@@ -530,6 +568,10 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
     forcePrecomputeAnalyses(F);
   }
   
+  int instsBefore = 0;
+  if (!SILPassStatsJSONFile.empty())
+    instsBefore = countInstructions(F);
+
   llvm::sys::TimePoint<> startTime = std::chrono::system_clock::now();
   std::chrono::nanoseconds duration(0);
 
@@ -574,6 +616,10 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
     llvm::dbgs() << llvm::format("%9.3f", milliSecs) << " ms: " << SFT->getTag()
                  << " @" << F->getName() << "\n";
   }
+  if (SILPrintPassSummary)
+    recordPassSummary(SFT, duration, CurrentPassHasInvalidated);
+  if (!SILPassStatsJSONFile.empty())
+    recordPassRunStats(SFT, F, duration, countInstructions(F) - instsBefore);
 
   if (numRepeats > 1)
     F->deleteSnapshot(SnapshotID);
@@ -698,6 +744,8 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
   updateSILModuleStatsBeforeTransform(*Mod, SMT, *this, NumPassesRun);
 
   CurrentPassHasInvalidated = false;
+  FunctionsInvalidatedByCurrentPass.clear();
+  CurrentPassInvalidationIsComplete = true;
   numSubpassesRun = 0;
 
   if (SILPrintPassName)
@@ -723,6 +771,10 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   swiftPassInvocation.startModulePassRun(SMT);
 
+  int instsBefore = 0;
+  if (!SILPassStatsJSONFile.empty())
+    instsBefore = countInstructions(Mod);
+
   llvm::sys::TimePoint<> StartTime = std::chrono::system_clock::now();
   assert(analysesUnlocked() && "Expected all analyses to be unlocked!");
   SMT->run();
@@ -737,6 +789,11 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
     double milliSecs = (double)duration.count() / 1000000.;
     llvm::dbgs() << llvm::format("%9.3f", milliSecs) << " ms: " << SMT->getTag() << "\n";
   }
+  if (SILPrintPassSummary)
+    recordPassSummary(SMT, duration, CurrentPassHasInvalidated);
+  if (!SILPassStatsJSONFile.empty())
+    recordPassRunStats(SMT, /*F=*/nullptr, duration,
+                       countInstructions(Mod) - instsBefore);
 
   // If this pass invalidated anything, print and verify.
   if (doPrintAfter(SMT, nullptr, CurrentPassHasInvalidated)) {
@@ -748,7 +805,20 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   if (Options.VerifyAll &&
       (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
-    Mod->verify();
+    // Function passes only re-verify the function they changed; module
+    // passes traditionally re-verify the whole module, which dominates the
+    // cost of verify-enabled -O builds. In incremental mode, trust the
+    // invalidation notifications the same way the function-pass path does:
+    // if the pass attributed every invalidation to specific functions,
+    // verify just those. A module-wide invalidation or a vtable/witness
+    // table change still falls back to full verification, since table
+    // entries are not covered by per-function verification.
+    if (SILVerifyIncremental && CurrentPassInvalidationIsComplete) {
+      for (SILFunction *F : FunctionsInvalidatedByCurrentPass)
+        F->verify(/*SingleFunction=*/false);
+    } else {
+      Mod->verify();
+    }
     verifyAnalyses();
   } else {
     if ((SILVerifyAfterPass.end() != std::find_if(SILVerifyAfterPass.begin(),
@@ -833,14 +903,77 @@ void SILPassManager::execute() {
   }
 }
 
+void SILPassManager::recordPassSummary(SILTransform *T,
+                                       std::chrono::nanoseconds duration,
+                                       bool changedSomething) {
+  PassRunSummary &summary = passSummaries[(unsigned)T->getPassKind()];
+  summary.tag = T->getTag();
+  summary.runtime += duration;
+  summary.numRuns += 1;
+  if (changedSomething)
+    summary.numRunsWithChanges += 1;
+}
+
+void SILPassManager::recordPassRunStats(SILTransform *T, SILFunction *F,
+                                        std::chrono::nanoseconds duration,
+                                        int instructionDelta) {
+  passRunStats.push_back({T->getTag(), F ? F->getName().str() : std::string(),
+                          duration, instructionDelta,
+                          Mod->getBytesAllocated()});
+}
+
+/// Append the recorded pass runs to the file specified by
+/// -sil-pass-stats-json, one JSON object per line. Appending keeps the
+/// records of all pass managers of a compilation in a single file, which a
+/// plain JSON array could not.
+static void writePassStatsJSON(
+    ArrayRef<SILPassManager::PassRunStats> stats) {
+  std::error_code errorCode;
+  llvm::raw_fd_ostream out(SILPassStatsJSONFile, errorCode,
+                           llvm::sys::fs::OF_Append);
+  if (errorCode) {
+    llvm::errs() << "error opening '" << SILPassStatsJSONFile
+                 << "': " << errorCode.message() << '\n';
+    return;
+  }
+  for (const SILPassManager::PassRunStats &s : stats) {
+    llvm::json::Object obj({{"pass", s.tag},
+                            {"time_ns", (int64_t)s.runtime.count()},
+                            {"inst_delta", s.instructionDelta},
+                            {"alloc_bytes", (int64_t)s.allocatedBytes}});
+    if (!s.function.empty())
+      obj["function"] = s.function;
+    out << llvm::json::Value(std::move(obj)) << '\n';
+  }
+}
+
 /// D'tor.
 SILPassManager::~SILPassManager() {
 
+  if (!SILPassStatsJSONFile.empty() && !passRunStats.empty())
+    writePassStatsJSON(passRunStats);
+
   if (SILOptProfileRepeat > 1) {
     double milliSecs = (double)totalPassRuntime.count() / 1000000.;
     llvm::dbgs() << llvm::format("%9.3f", milliSecs) << " ms: total runtime of all passes\n";
   }
 
+  if (SILPrintPassSummary && !passSummaries.empty()) {
+    llvm::SmallVector<const PassRunSummary *, 64> summaries;
+    for (auto &entry : passSummaries)
+      summaries.push_back(&entry.second);
+    llvm::sort(summaries, [](const PassRunSummary *a, const PassRunSummary *b) {
+      return a->runtime > b->runtime;
+    });
+    llvm::dbgs() << "Pass summary:\n";
+    for (const PassRunSummary *s : summaries) {
+      double milliSecs = (double)s->runtime.count() / 1000000.;
+      llvm::dbgs() << llvm::format("%9.3f", milliSecs) << " ms: " << s->tag
+                   << " (" << s->numRuns << " runs, " << s->numRunsWithChanges
+                   << " changed anything)\n";
+    }
+  }
+
   // Before we do anything further, verify the module and our analyses. These
   // are natural points with which to verify.
   //
@@ -113,6 +113,17 @@ static void addDefiniteInitialization(SILPassPipelinePlan &P) {
 //
 // Any passes not needed for diagnostic emission that need to run at -Onone
 // should be in the -Onone pass pipeline and the prepare optimizations pipeline.
+//
+// Fusing these passes into a shared CFG walk to cut -Onone time has been
+// considered and doesn't work: the ordering comments below are load-bearing.
+// Each stage consumes the dialect the previous one produced (DI requires raw
+// SIL, RawSILInstLowering removes it, MandatoryInlining and the checkers then
+// rewrite the CFG that later diagnostics walk), so there is no common
+// function state a combined traversal could share. The per-pass traversal
+// overhead is instead kept low structurally: runFunctionPasses pushes each
+// function through all consecutive function passes back-to-back while it is
+// cache-hot, and the completed-passes mask skips re-runs when nothing was
+// invalidated.
 static void addMandatoryDiagnosticOptPipeline(SILPassPipelinePlan &P) {
   P.startPipeline("Mandatory Diagnostic Passes + Enabling Optimization Passes");
   P.addSILGenCleanup();
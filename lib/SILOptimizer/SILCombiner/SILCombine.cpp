@@ -49,6 +49,7 @@ using namespace swift;
 
 STATISTIC(NumCombined, "Number of instructions combined");
 STATISTIC(NumDeadInst, "Number of dead insts eliminated");
+STATISTIC(NumVisits, "Number of instructions visited");
 
 static llvm::cl::opt<bool> EnableSinkingOwnedForwardingInstToUses(
     "silcombine-owned-code-sinking",
@@ -409,6 +410,13 @@ bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
     if (I == nullptr)
       continue;
 
+    // Count real visits (popped, non-blotted entries); with -stats this is
+    // the number to watch when a function revisits instructions excessively.
+    // Membership is already O(1): the worklist is a BlotSetVector whose
+    // DenseMap rejects duplicate adds, so eager user re-adds cannot enqueue
+    // an instruction twice.
+    ++NumVisits;
+
     if (!parentTransform->continueWithNextSubpassRun(I))
       return false;
 
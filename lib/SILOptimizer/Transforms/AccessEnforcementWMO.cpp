@@ -51,6 +51,19 @@
 /// instructions. Ignoring any access pattern would weaken enforcement. For
 /// example, AccessStorageAnalysis cannot be used here because that analysis
 /// may conservatively summarize some functions.
+///
+/// Note: The module boundary here is a hard limit, not a missed optimization.
+/// Serializing this pass's results into the swiftmodule so that clients could
+/// demote their accesses to a framework's storage would require
+/// conflict-freedom to be a whole-program fact: storage a client can access
+/// is storage every other client can also access (including via keypaths the
+/// defining module never sees), so no single module's summary can vouch for
+/// it. The summary would also become ABI -- a later framework revision that
+/// adds a keypath or escaping access would silently invalidate enforcement
+/// that already-compiled clients dropped, turning exclusivity violations into
+/// undetected memory unsafety rather than traps. Accesses to other modules'
+/// globals deliberately come back as Unidentified storage for the same
+/// reason.
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "access-enforcement-wmo"
@@ -762,9 +762,13 @@ void DSEContext::invalidateBaseForGenKillSet(SILValue B, BlockState *S) {
 }
 
 void DSEContext::invalidateBaseForDSE(SILValue B, BlockState *S) {
-  for (unsigned i = 0; i < S->LocationNum; ++i) {
-    if (!S->BBWriteSetMid.test(i))
-      continue;
+  // Only visit the tracked locations. On machine-generated functions the
+  // location universe can be large while only few locations have an upward
+  // visible store, so iterating the set bits instead of all locations
+  // matters. Clearing the current bit does not affect find_next, which only
+  // scans forward.
+  for (int i = S->BBWriteSetMid.find_first(); i != -1;
+       i = S->BBWriteSetMid.find_next(i)) {
     if (LocationVault[i].getBase() != B)
       continue;
     S->stopTrackingLocation(S->BBWriteSetMid, i);
@@ -794,9 +798,8 @@ void DSEContext::processReadForDSE(BlockState *S, unsigned bit) {
   // Remove any may/must-aliasing stores to the LSLocation, as they can't be
   // used to kill any upward visible stores due to the interfering load.
   LSLocation &R = LocationVault[bit];
-  for (unsigned i = 0; i < S->LocationNum; ++i) {
-    if (!S->isTrackingLocation(S->BBWriteSetMid, i))
-      continue;
+  for (int i = S->BBWriteSetMid.find_first(); i != -1;
+       i = S->BBWriteSetMid.find_next(i)) {
     LSLocation &L = LocationVault[i];
     if (!L.isMayAliasLSLocation(R, AA))
       continue;
@@ -811,9 +814,8 @@ void DSEContext::processReadForGenKillSet(BlockState *S, unsigned bit) {
   // Even though, LSLocations are canonicalized, we still need to consult
   // alias analysis to determine whether 2 LSLocations are disjointed.
   LSLocation &R = LocationVault[bit];
-  for (unsigned i = 0; i < S->LocationNum; ++i) {
-    if (!S->BBMaxStoreSet.test(i))
-      continue;
+  for (int i = S->BBMaxStoreSet.find_first(); i != -1;
+       i = S->BBMaxStoreSet.find_next(i)) {
     // Do nothing if the read location NoAlias with the current location.
     LSLocation &L = LocationVault[i];
     if (!L.isMayAliasLSLocation(R, AA))
@@ -885,9 +887,8 @@ bool DSEContext::processWriteForDSE(BlockState *S, unsigned bit) {
   // If a tracked store must aliases with this store, then this store is dead.
   bool StoreDead = false;
   LSLocation &R = LocationVault[bit];
-  for (unsigned i = 0; i < S->LocationNum; ++i) {
-    if (!S->isTrackingLocation(S->BBWriteSetMid, i))
-      continue;
+  for (int i = S->BBWriteSetMid.find_first(); i != -1;
+       i = S->BBWriteSetMid.find_next(i)) {
     // If 2 locations may alias, we can still keep both stores.
     LSLocation &L = LocationVault[i];
     if (!L.isMustAliasLSLocation(R, AA))
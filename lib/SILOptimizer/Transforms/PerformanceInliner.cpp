@@ -907,6 +907,16 @@ void SILPerformanceInliner::collectAppliesToInline(
   llvm::DenseMap<SILBasicBlock *, uint64_t> BBToWeightMap;
   calculateBBWeights(Caller, DT, BBToWeightMap);
 
+  // Whether the given block was never reached in the recorded profile.
+  // When profile data is available this is a stronger cold-path signal
+  // than the static branch-hint heuristics in ColdBlockInfo.
+  auto isProfiledColdBlock = [](const llvm::DenseMap<SILBasicBlock *, uint64_t>
+                                    &weightMap,
+                                SILBasicBlock *block) {
+    auto it = weightMap.find(block);
+    return it != weightMap.end() && it->getSecond() == 0;
+  };
+
   // Go through all instructions and find candidates for inlining.
   // We do this in dominance order for the constTracker.
   SmallVector<FullApplySite, 8> InitialCandidates;
@@ -954,7 +964,8 @@ void SILPerformanceInliner::collectAppliesToInline(
     }
 
     domOrder.pushChildrenIf(block, [&] (SILBasicBlock *child) {
-      if (CBI.isSlowPath(block, child)) {
+      if (CBI.isSlowPath(block, child) ||
+          isProfiledColdBlock(BBToWeightMap, child)) {
         // Handle cold blocks separately.
         visitColdBlocks(InitialCandidates, child, DT);
         return false;
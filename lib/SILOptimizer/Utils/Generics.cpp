@@ -2045,8 +2045,18 @@ SILFunction *GenericFuncSpecializer::lookupSpecialization() {
     // Otherwise we could end up that another de-serialized function from the
     // same module would reference the new (non-external) specialization we
     // would create here.
-    SpecializedF = M.loadFunction(ClonedName, SILModule::LinkingMode::LinkAll,
-                                  SILLinkage::Shared);
+    //
+    // An imported module can only contain such a specialization if the
+    // generic function itself is visible to it. Generic functions which are
+    // defined in the module currently being compiled cannot be referenced
+    // from any module we import (imports are acyclic), so skip the scan over
+    // all deserialized modules for them.
+    if (!GenericFunc->isDefinition() ||
+        GenericFunc->isAvailableExternally() ||
+        GenericFunc->wasDeserializedCanonical()) {
+      SpecializedF = M.loadFunction(ClonedName, SILModule::LinkingMode::LinkAll,
+                                    SILLinkage::Shared);
+    }
   }
   if (SpecializedF) {
     if (ReInfo.getSpecializedType() != SpecializedF->getLoweredFunctionType()) {
@@ -796,7 +796,8 @@ getConstructorParamsAsTuples(ASTContext &ctx, Type boundTy1, Type boundTy2) {
 
 SolutionCompareResult ConstraintSystem::compareSolutions(
     ConstraintSystem &cs, ArrayRef<Solution> solutions,
-    const SolutionDiff &diff, unsigned idx1, unsigned idx2) {
+    llvm::function_ref<const SolutionDiff &()> getDiff, unsigned idx1,
+    unsigned idx2) {
   if (cs.isDebugMode()) {
     llvm::errs().indent(cs.solverState->getCurrentIndent())
       << "comparing solutions " << idx1 << " and " << idx2 <<"\n";
@@ -835,7 +836,8 @@ SolutionCompareResult ConstraintSystem::compareSolutions(
     return 1;
   };
 
-  SmallVector<SolutionDiff::OverloadDiff, 4> overloadDiff(diff.overloads);
+  SmallVector<SolutionDiff::OverloadDiff, 4> overloadDiff(
+      getDiff().overloads);
   // Single type of keypath dynamic member lookup could refer to different
   // member overloads, we have to do a pair-wise comparison in such cases
   // otherwise ranking would miss some viable information e.g.
@@ -1365,7 +1367,14 @@ ConstraintSystem::findBestSolution(SmallVectorImpl<Solution> &viable,
     }
   }
 
-  SolutionDiff diff(viable);
+  // Materialize the diff between the solutions only if a comparison gets
+  // past the score vector; comparisons decided by score alone never need it.
+  Optional<SolutionDiff> diff;
+  auto getDiff = [&]() -> const SolutionDiff & {
+    if (!diff)
+      diff.emplace(viable);
+    return *diff;
+  };
 
   // Find a potential best.
   SmallVector<bool, 16> losers(viable.size(), false);
@@ -1377,7 +1386,7 @@ ConstraintSystem::findBestSolution(SmallVectorImpl<Solution> &viable,
     if (currScore < bestScore)
       bestScore = currScore;
 
-    switch (compareSolutions(*this, viable, diff, i, bestIdx)) {
+    switch (compareSolutions(*this, viable, getDiff, i, bestIdx)) {
     case SolutionCompareResult::Identical:
       // FIXME: Might want to warn about this in debug builds, so we can
       // find a way to eliminate the redundancy in the search space.
@@ -1405,7 +1414,7 @@ ConstraintSystem::findBestSolution(SmallVectorImpl<Solution> &viable,
     if (i == bestIdx)
       continue;
 
-    switch (compareSolutions(*this, viable, diff, bestIdx, i)) {
+    switch (compareSolutions(*this, viable, getDiff, bestIdx, i)) {
     case SolutionCompareResult::Identical:
       // FIXME: Might want to warn about this in debug builds, so we can
       // find a way to eliminate the redundancy in the search space.
@@ -491,6 +491,10 @@ ConstraintSystem::SolverState::~SolverState() {
          "Expected constraint system to have this solver state!");
   CS.solverState = nullptr;
 
+  // A failed constraint recorded along the solver path lives in the
+  // per-solve arena and is about to be released with it.
+  CS.failedConstraint = nullptr;
+
   // If constraint system ended up being in an invalid state
   // let's just drop the state without attempting to rollback.
   if (CS.inInvalidState())
@@ -1358,6 +1362,17 @@ Optional<std::vector<Solution>> ConstraintSystem::solve(
           .Diags.diagnose(affectedRange->Start, diag::expression_too_complex)
           .highlight(*affectedRange);
 
+      // If we know which disjunction consumed the solver's budget, point at
+      // its subexpression unless the error already covers exactly that.
+      auto costliestRange = CostliestDisjunction.first;
+      if (costliestRange.isValid() && costliestRange != *affectedRange) {
+        getASTContext()
+            .Diags
+            .diagnose(costliestRange.Start,
+                      diag::expression_too_complex_subexpression)
+            .highlight(costliestRange);
+      }
+
       solution.markAsDiagnosed();
       return None;
     }
@@ -810,6 +810,8 @@ bool DisjunctionStep::attempt(const DisjunctionChoice &choice) {
   // If the disjunction requested us to, remember which choice we
   // took for it.
   if (auto *disjunctionLocator = getLocator()) {
+    CS.recordDisjunctionChoiceAttempt(disjunctionLocator);
+
     auto index = choice.getIndex();
     recordDisjunctionChoice(disjunctionLocator, index);
 
@@ -796,6 +796,10 @@ namespace {
     ConstraintGraph &cg;
     ArrayRef<TypeVariableType *> typeVars;
 
+    /// The set of type variables in \c typeVars, used to bias union-find
+    /// representatives toward type variables the client asked about.
+    llvm::SmallDenseSet<TypeVariableType *> typeVarSet;
+
     /// A mapping from each type variable to its representative in a union-find
     /// data structure, excluding entries where the type variable is its own
     /// representative.
@@ -832,6 +836,8 @@ namespace {
                         ArrayRef<TypeVariableType *> typeVars)
         : cg(cg), typeVars(typeVars)
     {
+      typeVarSet.insert(typeVars.begin(), typeVars.end());
+
       auto oneWayConstraints = connectedComponents();
 
       // If there were no one-way constraints, we're done.
@@ -1012,52 +1018,86 @@ namespace {
       if (rep1 == rep2)
         return false;
 
-      // Reparent the type variable with the higher ID. The actual choice doesn't
-      // matter, but this makes debugging easier.
-      if (rep1->getID() < rep2->getID())
+      // Reparent so that the surviving representative is one of the type
+      // variables the client asked about, when there is a choice; among
+      // those, prefer the type variable with the lower ID to make debugging
+      // easier.
+      bool rep1Known = typeVarSet.count(rep1) > 0;
+      bool rep2Known = typeVarSet.count(rep2) > 0;
+      if (rep1Known != rep2Known) {
+        if (rep1Known)
+          representatives[rep2] = rep1;
+        else
+          representatives[rep1] = rep2;
+      } else if (rep1->getID() < rep2->getID()) {
         representatives[rep2] = rep1;
-      else
+      } else {
         representatives[rep1] = rep2;
+      }
       return true;
     }
 
-    /// Perform the connected components algorithm, skipping one-way
+    /// Perform the connected components algorithm by taking the union of
+    /// the endpoints of each edge in the graph, skipping one-way
     /// constraints.
     ///
+    /// Unlike the depth-first search this replaces, the union-find pass
+    /// visits each type variable and each constraint exactly once and does
+    /// not recurse, so large result-builder bodies neither pay for repeated
+    /// adjacency walks nor risk exhausting the stack.
+    ///
     /// \returns the set of one-way constraints that were skipped.
     TinyPtrVector<Constraint *> connectedComponents() {
       TinyPtrVector<Constraint *> oneWayConstraints;
 
-      // Perform a depth-first search from each type variable to identify
-      // what component it is in.
-      for (auto typeVar : typeVars) {
-        // If we've already assigned a representative to this type variable,
-        // we're done.
-        if (representatives.count(typeVar) > 0)
-          continue;
+      // Seed the worklist with the requested type variables, expanding the
+      // frontier to adjacent type variables discovered along the way so that
+      // components connected through type variables outside \c typeVars stay
+      // intact.
+      SmallVector<TypeVariableType *, 16> worklist(typeVars.begin(),
+                                                   typeVars.end());
+      llvm::SmallPtrSet<TypeVariableType *, 16> visitedVars(typeVars.begin(),
+                                                            typeVars.end());
+      auto visitAdjacency = [&](TypeVariableType *typeVar,
+                                TypeVariableType *adj) {
+        unionSets(typeVar, adj);
+        if (visitedVars.insert(adj).second)
+          worklist.push_back(adj);
+      };
 
-        // Perform a depth-first search to mark those type variables that are
-        // in the same component as this type variable.
-        depthFirstSearch(
-            cg, typeVar,
-            [&](TypeVariableType *found) {
-              // If we have already seen this node, we're done.
-              auto inserted = representatives.insert({found, typeVar});
-              assert((inserted.second || inserted.first->second == typeVar) &&
-                     "Wrong component?");
-
-              return inserted.second;
-            },
-            [&](Constraint *constraint) {
-              // Record and skip one-way constraints.
-              if (constraint->isOneWayConstraint()) {
-                oneWayConstraints.push_back(constraint);
-                return false;
-              }
+      while (!worklist.empty()) {
+        auto *typeVar = worklist.pop_back_val();
+        auto &node = cg[typeVar];
 
-              return true;
-            },
-            visitedConstraints);
+        for (auto *constraint : node.getConstraints()) {
+          // If we've already seen this constraint, skip it.
+          if (!visitedConstraints.insert(constraint).second)
+            continue;
+
+          // Record and skip one-way constraints.
+          if (constraint->isOneWayConstraint()) {
+            oneWayConstraints.push_back(constraint);
+            continue;
+          }
+
+          for (auto *adj : constraint->getTypeVariables())
+            visitAdjacency(typeVar, adj);
+        }
+
+        // Union with the other members of this type variable's equivalence
+        // class.
+        auto *repTypeVar = cg.getConstraintSystem().getRepresentative(typeVar);
+        visitAdjacency(typeVar, repTypeVar);
+        if (typeVar == repTypeVar) {
+          for (auto *eqClassMember : node.getEquivalenceClass())
+            visitAdjacency(typeVar, eqClassMember);
+        }
+
+        // Union with type variables related via fixed bindings.
+        for (auto *adj : node.getReferencedBy())
+          visitAdjacency(typeVar, adj);
+        for (auto *adj : node.getReferencedVars())
+          visitAdjacency(typeVar, adj);
       }
 
       return oneWayConstraints;
@@ -244,9 +244,22 @@ void ConstraintSystem::addTypeVariableConstraintsToWorkList(
        TypeVariableType *typeVar) {
   // Activate the constraints affected by a change to this type variable.
   auto gatheringKind = ConstraintGraph::GatheringKind::AllMentions;
-  for (auto *constraint : CG.gatherConstraints(typeVar, gatheringKind))
-    if (!constraint->isActive())
-      activateConstraint(constraint);
+  for (auto *constraint : CG.gatherConstraints(typeVar, gatheringKind)) {
+    if (constraint->isActive())
+      continue;
+
+    // A one-way constraint can only make progress once its right-hand side
+    // is fully resolved. Result builders chain many of these together, and
+    // waking one up every time a single right-hand type variable gets bound
+    // just re-simplifies the right-hand type and returns the constraint to
+    // the inactive set. Leave it asleep until the binding that resolves the
+    // last of its right-hand type variables, which takes this path too.
+    if (constraint->isOneWayConstraint() &&
+        simplifyType(constraint->getSecondType())->hasTypeVariable())
+      continue;
+
+    activateConstraint(constraint);
+  }
 }
 
 /// Retrieve a dynamic result signature for the given declaration.
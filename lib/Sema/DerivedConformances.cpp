@@ -26,6 +26,16 @@
 
 using namespace swift;
 
+// Note on caching: it is tempting to key synthesized bodies by a structural
+// signature of the nominal (member types in order) and reuse the AST for the
+// thousands of small structs that share a layout. That doesn't work at this
+// level: every synthesized body holds DeclRefs to the specific type's own
+// member declarations and self parameter, and there is no general AST cloner
+// to rebind them. The sound levers are (a) returning bodies already
+// type-checked so structurally identical bodies at least skip the constraint
+// solver (see deriveBodyHashable_hashValue), and (b) letting SIL/LLVM
+// function merging collapse the identical code that multiple types lower to.
+
 enum NonconformingMemberKind { AssociatedValue, StoredProperty };
 
 DerivedConformance::DerivedConformance(ASTContext &ctx, Decl *conformanceDecl,
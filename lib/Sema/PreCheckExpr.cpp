@@ -535,7 +535,31 @@ Expr *TypeChecker::resolveDeclRefExpr(UnresolvedDeclRefExpr *UDRE,
     if (Loc.isInvalid())
       DC = DC->getModuleScopeContext();
 
-    Lookup = TypeChecker::lookupUnqualified(DC, LookupName, Loc, lookupOptions);
+    // Operator functions can only be declared at file scope or as members
+    // of a type, so the candidate set depends only on the name and the
+    // innermost type context. Reuse the result of an earlier walk for the
+    // same operator in the same context; `+`, `==`, and friends recur
+    // constantly within a file.
+    OperatorLookupCache *opCache = nullptr;
+    const DeclContext *opCacheKey = nullptr;
+    if (Name.isOperator()) {
+      if (auto *sourceFile = DC->getParentSourceFile()) {
+        opCache = &sourceFile->getOperatorLookupCache();
+        opCacheKey = DC->getInnermostTypeContext();
+        if (auto *cached = opCache->lookup(LookupName.getFullName(),
+                                           opCacheKey)) {
+          Lookup = *cached;
+          opCache = nullptr;
+        }
+      }
+    }
+
+    if (!Lookup) {
+      Lookup =
+          TypeChecker::lookupUnqualified(DC, LookupName, Loc, lookupOptions);
+      if (opCache)
+        opCache->record(LookupName.getFullName(), opCacheKey, Lookup);
+    }
 
     ValueDecl *localDeclAfterUse = nullptr;
     AllDeclRefs =
@@ -27,8 +27,10 @@
 #include "swift/AST/PrettyStackTrace.h"
 #include "swift/AST/SubstitutionMap.h"
 #include "swift/AST/TypeCheckRequests.h"
+#include "swift/Basic/StableHasher.h"
 #include "swift/Basic/Statistic.h"
 #include "swift/IDE/TypeCheckCompletionCallback.h"
+#include "swift/Parse/Lexer.h"
 #include "swift/Sema/ConstraintSystem.h"
 #include "swift/Sema/SolutionResult.h"
 #include "llvm/ADT/DenseMap.h"
@@ -388,6 +390,37 @@ TypeChecker::typeCheckExpression(SolutionApplicationTarget &target,
   return typeCheckTarget(target, options);
 }
 
+/// Compute a stable fingerprint of a pre-checked expression together with an
+/// approximation of its lookup environment.
+///
+/// The fingerprint hashes the expression's source text, the enclosing
+/// module's name, and the enclosing source file's imports - the inputs that
+/// determine the overload sets the solver will consider - so it is stable
+/// across frontend invocations and suitable for keying a cross-build cache
+/// of solutions. For now it feeds counters that measure how often the solver
+/// revisits structurally identical expressions.
+static Optional<Fingerprint> getExprSolveFingerprint(Expr *expr,
+                                                     DeclContext *dc) {
+  auto &ctx = dc->getASTContext();
+  auto range = expr->getSourceRange();
+  if (range.isInvalid())
+    return None;
+
+  auto charRange =
+      Lexer::getCharSourceRangeFromSourceRange(ctx.SourceMgr, range);
+  StableHasher hasher = StableHasher::defaultHasher();
+  hasher.combine(ctx.SourceMgr.extractText(charRange));
+  hasher.combine(uint8_t{0});
+  hasher.combine(dc->getParentModule()->getNameStr());
+  if (auto *sourceFile = dc->getParentSourceFile()) {
+    for (const auto &import : sourceFile->getImports()) {
+      hasher.combine(uint8_t{0});
+      hasher.combine(import.module.importedModule->getNameStr());
+    }
+  }
+  return Fingerprint{std::move(hasher)};
+}
+
 Optional<SolutionApplicationTarget>
 TypeChecker::typeCheckTarget(SolutionApplicationTarget &target,
                              TypeCheckExprOptions options) {
@@ -404,6 +437,20 @@ TypeChecker::typeCheckTarget(SolutionApplicationTarget &target,
     return None;
   }
 
+  // When gathering statistics, account for solves of expressions whose
+  // fingerprint was already seen in this invocation; these are the candidates
+  // a fingerprint-keyed solution cache would be able to serve.
+  if (Context.Stats) {
+    if (auto *expr = target.getAsExpr()) {
+      if (auto fingerprint = getExprSolveFingerprint(expr, dc)) {
+        auto &counters = Context.Stats->getFrontendCounters();
+        ++counters.NumExprSolvesFingerprinted;
+        if (Context.recordSolvedExprFingerprint(*fingerprint))
+          ++counters.NumRepeatedExprSolves;
+      }
+    }
+  }
+
   // Check whether given target has a code completion token which requires
   // special handling.
   if (Context.CompletionCallback &&
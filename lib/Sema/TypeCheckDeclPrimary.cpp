@@ -3000,9 +3000,11 @@ public:
         !hasHistoricallyWrongAvailability(FD))
       TypeChecker::checkConcurrencyAvailability(FD->getAsyncLoc(), FD);
     
-    if (requiresDefinition(FD) && !FD->hasBody()) {
+    if (requiresDefinition(FD) && !FD->hasBody() && !FD->isBodySkipped()) {
       // Complain if we should have a body.
       FD->diagnose(diag::func_decl_without_brace);
+    } else if (FD->isBodySkipped()) {
+      // The body was already skipped during parsing.
     } else if (FD->getDeclContext()->isLocalContext()) {
       // Check local function bodies right away.
       (void)FD->getTypecheckedBody();
@@ -458,6 +458,16 @@ SILGlobalVariable *SILDeserializer::getGlobalForReference(StringRef name) {
   return readGlobalVar(name);
 }
 
+// Note on parallelizing this path: the per-function work looks independent
+// once the tables are read, but it is not. Every function decode seeks the
+// single shared SILCursor, routes types and decls through ModuleFile into the
+// ASTContext's bump-pointer arenas, and inserts into SILModule's function
+// list and caches, none of which tolerate concurrent mutation. Per-thread
+// value maps only cover LocalValues; they do not isolate the allocators or
+// the module. The supported way to overlap this cost with other work is at
+// the job level (parallel frontend jobs, and parallel IRGen once SIL is
+// complete), not inside a single SILDeserializer.
+
 /// Deserialize a SILFunction if it is not already deserialized. The input
 /// SILFunction can either be an empty declaration or null. If it is an empty
 /// declaration, we fill in the contents. If the input SILFunction is
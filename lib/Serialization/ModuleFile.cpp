@@ -913,6 +913,7 @@ void ModuleFile::getTopLevelDecls(
        SmallVectorImpl<Decl *> &results,
        llvm::function_ref<bool(DeclAttributes)> matchAttributes) {
   PrettyStackTraceModuleFile stackEntry(*this);
+  results.reserve(results.size() + Core->OrderedTopLevelDecls.size());
   for (DeclID entry : Core->OrderedTopLevelDecls) {
     Expected<Decl *> declOrError = getDeclChecked(entry, matchAttributes);
     if (!declOrError) {
@@ -934,6 +935,7 @@ void ModuleFile::getTopLevelDecls(
 
 void ModuleFile::getExportedPrespecializations(
     SmallVectorImpl<Decl *> &results) {
+  results.reserve(results.size() + Core->ExportedPrespecializationDecls.size());
   for (DeclID entry : Core->ExportedPrespecializationDecls) {
     Expected<Decl *> declOrError = getDeclChecked(entry);
     if (!declOrError) {
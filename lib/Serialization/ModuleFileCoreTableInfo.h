@@ -21,6 +21,13 @@
 
 namespace swift {
 
+// Note on ownership: the Info classes below are instantiated over
+// llvm::OnDiskChainedHashTable views created directly on top of the module
+// file's (typically mmapped) buffer, so the table bytes are never copied into
+// owned storage. \c ReadData decodes a single bucket only when its key is
+// looked up; whole-table scans should prefer the flat index records (such as
+// ORDERED_TOP_LEVEL_DECLS) when one exists rather than walking every bucket.
+
 /// Used to deserialize entries in the on-disk decl hash table.
 class ModuleFileSharedCore::DeclTableInfo {
 public:
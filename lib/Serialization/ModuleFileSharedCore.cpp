@@ -20,6 +20,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/OnDiskHashTable.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Threading.h"
 
 using namespace swift;
 using namespace swift::serialization;
@@ -589,7 +590,35 @@ void ModuleFileSharedCore::outputDiagnosticInfo(llvm::raw_ostream &os) const {
     os << " at '" << ModuleInputBuffer->getBufferIdentifier() << "'";
 }
 
-ModuleFileSharedCore::~ModuleFileSharedCore() { }
+ModuleFileSharedCore::~ModuleFileSharedCore() {
+  if (ModuleBufferPrefetchThread.joinable())
+    ModuleBufferPrefetchThread.join();
+}
+
+void ModuleFileSharedCore::startBufferPrefetch() {
+#if LLVM_ENABLE_THREADS
+  // Only buffers large enough to have been mmapped benefit from prefetching;
+  // anything smaller is already resident once the header has been validated.
+  const size_t minPrefetchSize = 1 << 20;
+  if (!ModuleInputBuffer ||
+      ModuleInputBuffer->getBufferSize() < minPrefetchSize)
+    return;
+
+  const char *begin = ModuleInputBuffer->getBufferStart();
+  const char *end = ModuleInputBuffer->getBufferEnd();
+  ModuleBufferPrefetchThread = std::thread([begin, end] {
+    // Touch one byte per page to pull the module contents into the page cache
+    // while the client begins type checking against the lazily deserialized
+    // tables. The buffer is immutable, so racing with concurrent readers is
+    // benign.
+    const size_t pageSize = 4096;
+    volatile char sink = 0;
+    for (const char *ptr = begin; ptr < end; ptr += pageSize)
+      sink += *ptr;
+    (void)sink;
+  });
+#endif
+}
 
 std::unique_ptr<ModuleFileSharedCore::SerializedDeclTable>
 ModuleFileSharedCore::readDeclTable(ArrayRef<uint64_t> fields,
@@ -18,6 +18,7 @@
 #include "swift/AST/Module.h"
 #include "swift/Serialization/Validation.h"
 #include "llvm/Bitstream/BitstreamReader.h"
+#include <thread>
 
 namespace llvm {
   template <typename Info> class OnDiskIterableChainedHashTable;
@@ -45,6 +46,11 @@ class ModuleFileSharedCore {
   std::unique_ptr<llvm::MemoryBuffer> ModuleDocInputBuffer;
   std::unique_ptr<llvm::MemoryBuffer> ModuleSourceInfoInputBuffer;
 
+  /// Touches the pages of \c ModuleInputBuffer on a background thread so that
+  /// lazy deserialization does not stall on cold page cache reads. Joined in
+  /// the destructor; the thread only performs reads of the immutable buffer.
+  std::thread ModuleBufferPrefetchThread;
+
   /// The cursor used to lazily load things from the file.
   llvm::BitstreamCursor DeclTypeCursor;
 
@@ -379,6 +385,10 @@ private:
       bool isFramework, bool requiresOSSAModules, StringRef requiredSDK,
       serialization::ValidationInfo &info, PathObfuscator &pathRecoverer);
 
+  /// Kicks off \c ModuleBufferPrefetchThread for sufficiently large module
+  /// buffers. No-op when threading is unavailable.
+  void startBufferPrefetch();
+
   /// Change the status of the current module.
   Status error(Status issue) {
     assert(issue != Status::Valid);
@@ -525,6 +535,8 @@ public:
       core->allocateBuffer(path, moduleInterfacePath);
       core->ModuleInterfacePath = StringRef(path.data(), path.size());
     }
+    if (info.status == Status::Valid)
+      core->startBufferPrefetch();
     theModule.reset(core);
     return info;
   }
@@ -60,6 +60,18 @@ const uint16_t SWIFTMODULE_VERSION_MAJOR = 0;
 /// Don't worry about adhering to the 80-column limit for this line.
 const uint16_t SWIFTMODULE_VERSION_MINOR = 718;  // element archetype
 
+// Note on compression: proposals to compress individual blocks (decl tables,
+// SIL, doc data) in place have not panned out. Offset-bearing records
+// (DeclOffsets, the on-disk hash tables, SIL function offsets) address
+// absolute positions in the bitstream, so independently compressed blocks
+// would invalidate every cursor seek and force a container redesign. It would
+// also defeat the mmap-based consumption of the index tables and the sharing
+// of clean file-backed pages across ASTContexts via ModuleFileSharedCore;
+// each decompressed section becomes private dirty memory per process.
+// Distribution-size concerns are better served by compressing at the
+// transport or filesystem layer, which achieves the same ratios without
+// affecting this format.
+
 /// A standard hash seed used for all string hashes in a serialized module.
 ///
 /// This is the same as the default used by llvm::djbHash, just provided
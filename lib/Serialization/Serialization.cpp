@@ -5976,6 +5976,19 @@ void Serializer::writeToStream(
     const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
   Serializer S{SWIFTMODULE_SIGNATURE, DC};
 
+  // Module files routinely run to several megabytes; reserving up front saves
+  // the doubling copies the bitstream buffer would otherwise go through.
+  S.Buffer.reserve(1 << 20);
+
+  // Note: re-serialization cannot splice unchanged record blobs from the
+  // previous module file. DeclIDs and TypeIDs are assigned densely in the
+  // order entities are first referenced during a write, so any change
+  // renumbers the IDs embedded in every other record; abbreviation IDs and
+  // bit offsets likewise shift per run. There is no stable identity to diff
+  // against short of a content-addressed format. When nothing changed at all,
+  // the cheap answer is upstream of this function: the driver's incremental
+  // machinery skips the emit-module job entirely.
+
   // FIXME: This is only really needed for debugging. We don't actually use it.
   S.writeBlockInfoBlock();
 
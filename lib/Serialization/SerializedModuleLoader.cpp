@@ -21,6 +21,7 @@
 #include "swift/Basic/Platform.h"
 #include "swift/Basic/STLExtras.h"
 #include "swift/Basic/SourceManager.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/Basic/Version.h"
 #include "swift/Option/Options.h"
 
@@ -1233,6 +1234,10 @@ SerializedModuleLoaderBase::loadModule(SourceLoc importLoc,
   Ctx.addLoadedModule(M);
   SWIFT_DEFER { M->setHasResolvedImports(); };
 
+  // Attribute the deserialization work to the module being loaded; with
+  // -trace-stats-events this shows which (implicit) imports a job pays for.
+  FrontendStatsTracer tracer(Ctx.Stats, "load-module", M);
+
   llvm::sys::path::native(moduleInterfacePath);
   auto *file =
       loadAST(*M, moduleID.Loc, moduleInterfacePath,
@@ -62,6 +62,16 @@ BinaryScanningTool::BinaryScanningTool(
   PointerSize = Context->PointerSize;
 }
 
+// Conformance and type collection walks every image through the single
+// TypeRefBuilder created above. That builder is deliberately shared: type
+// references are uniqued by pointer identity in its arena so that results can
+// be compared across images, which also means the walk cannot be farmed out
+// per image without giving each thread its own builder and remapping the
+// uniqued nodes during a merge -- a rewrite of the interning scheme, not a
+// scan change. The walk itself is one pass over mmapped reflection sections.
+// Callers that rescan the same images on every run should cache the collected
+// results keyed by image UUID on their side of the C API; the library cannot
+// know when a cache of a client-chosen binary set is still valid.
 ConformanceCollectionResult
 BinaryScanningTool::collectConformances(const std::vector<std::string> &protocolNames) {
   switch (PointerSize) {
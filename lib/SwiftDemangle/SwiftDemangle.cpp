@@ -18,6 +18,8 @@
 #include "swift/Demangling/Demangle.h"
 #include "swift/SwiftDemangle/SwiftDemangle.h"
 
+#include <cstring>
+
 static size_t swift_demangle_getDemangledName_Options(const char *MangledName,
     char *OutputBuffer, size_t Length,
     swift::Demangle::DemangleOptions DemangleOptions) {
@@ -50,6 +52,48 @@ size_t swift_demangle_getDemangledName(const char *MangledName,
                                                  Length, DemangleOptions);
 }
 
+size_t swift_demangle_getDemangledNames(const char *const *MangledNames,
+                                        const size_t *MangledNameLengths,
+                                        size_t NumMangledNames,
+                                        char *OutputBuffer, size_t Length) {
+  assert((MangledNames != nullptr && MangledNameLengths != nullptr) ||
+         NumMangledNames == 0);
+  assert(OutputBuffer != nullptr || Length == 0);
+
+  swift::Demangle::DemangleOptions DemangleOptions;
+  DemangleOptions.SynthesizeSugarOnTypes = true;
+
+  // One context for the whole batch. Clearing it between symbols recycles
+  // the demangler's dominant arena slab instead of freeing it, so a
+  // steady-state batch stops allocating per symbol.
+  swift::Demangle::Context DCtx;
+
+  size_t Required = 0;
+  size_t Offset = 0;
+  for (size_t i = 0; i < NumMangledNames; ++i) {
+    llvm::StringRef MangledName(MangledNames[i], MangledNameLengths[i]);
+
+    std::string Result;
+    if (swift::Demangle::isSwiftSymbol(MangledName))
+      Result = DCtx.demangleSymbolAsString(MangledName, DemangleOptions);
+    else
+      Result = MangledName.str();
+    DCtx.clear();
+
+    Required += Result.size() + 1;
+
+    // Copy as much as fits; every copied entry stays '\0'-terminated.
+    if (OutputBuffer && Offset < Length) {
+      size_t Space = Length - Offset - 1;
+      size_t ToCopy = Result.size() < Space ? Result.size() : Space;
+      memcpy(OutputBuffer + Offset, Result.data(), ToCopy);
+      OutputBuffer[Offset + ToCopy] = '\0';
+      Offset += ToCopy + 1;
+    }
+  }
+  return Required;
+}
+
 size_t swift_demangle_getSimplifiedDemangledName(const char *MangledName,
                                                  char *OutputBuffer,
                                                  size_t Length) {
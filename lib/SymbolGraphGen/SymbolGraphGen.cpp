@@ -72,6 +72,15 @@ symbolgraphgen::emitSymbolGraphForModule(ModuleDecl *M,
     
   SymbolGraphASTWalker Walker(*M, ExportedImportedModules, QualifiedImports, Options);
 
+  // This walk is intentionally serial. Both the walk and the later
+  // serialization trigger lazy semantic queries (interface printing, USR
+  // mangling, doc comment lookup) against the shared ASTContext, which is not
+  // thread-safe, so the decls of a single module cannot be walked on multiple
+  // threads. Parallelism across modules already exists one level up: each
+  // module is a separate frontend/swift-symbolgraph-extract invocation, and
+  // the build system is free to run those concurrently. Note also that the
+  // JSON below is streamed through llvm::json::OStream as it is produced; no
+  // in-memory object tree is ever built.
   for (auto *Decl : ModuleDecls) {
     Walker.walk(Decl);
   }
@@ -39,6 +39,7 @@
 #define SWIFT_OBJC_INTEROP 1
 #endif
 #include "llvm/ADT/PointerIntPair.h"
+#include "ConcurrencyCounters.h"
 #include "TaskPrivate.h"
 #include "VoucherSupport.h"
 
@@ -1110,6 +1111,9 @@ void DefaultActorImpl::enqueue(Job *job, JobPriority priority) {
   SWIFT_TASK_DEBUG_LOG("Enqueueing job %p onto actor %p at priority %#zx", job,
                        this, priority);
   concurrency::trace::actor_enqueue(this, job);
+  // Reaching here means the actor could not take the job synchronously.
+  concurrency::counters::increment(
+      concurrency::counters::ActorContendedEnqueue);
   auto oldState = _status().load(std::memory_order_relaxed);
   while (true) {
     auto newState = oldState;
@@ -1245,6 +1249,17 @@ Job * DefaultActorImpl::drainOne() {
 // At the point of return from the job execution, we may not be holding the lock
 // of the same actor that we had started off with, so we need to reevaluate what
 // the current actor is
+//
+// Note that this loop already batches: one activation drains jobs until the
+// actor empties out or shouldYieldThread() asks for the thread back, so the
+// executor handoff cost is per-activation, not per-message. The remaining
+// per-message cost is the single status CAS in drainOne, and that one is
+// load-bearing: draining the whole queue into a local list in one swap would
+// hide the pending jobs from the status word, so a higher-priority enqueue
+// or a priority-escalation request arriving mid-batch could no longer see or
+// reorder ahead of them, and the unlock-vs-concurrent-enqueue race below
+// relies on the queue emptying through the shared state. Keep batching at
+// the activation level.
 static void defaultActorDrain(DefaultActorImpl *actor) {
   SWIFT_TASK_DEBUG_LOG("Draining default actor %p", actor);
   DefaultActorImpl *currentActor = actor;
@@ -1517,6 +1532,7 @@ static void swift_job_runImpl(Job *job, ExecutorRef executor) {
   trackingInfo.enterAndShadow(executor);
 
   SWIFT_TASK_DEBUG_LOG("job %p", job);
+  concurrency::counters::increment(concurrency::counters::JobRun);
   runJobInEstablishedExecutorContext(job);
 
   trackingInfo.leave();
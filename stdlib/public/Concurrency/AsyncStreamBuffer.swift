@@ -54,6 +54,16 @@ func _unlock(_ ptr: UnsafeRawPointer)
 
 @available(SwiftStdlib 5.1, *)
 extension AsyncStream {
+  // Note on the locking strategy: a lock-free single-producer/single-consumer
+  // ring buffer mode has been considered for high-rate streams, and rejected.
+  // Nothing in the API restricts a stream to one producer -- yield, finish,
+  // and the termination handler may race from any thread, and a mode
+  // "negotiated at creation" would be an unverifiable promise whose violation
+  // corrupts the buffer. The suspension handoff in next() would still need an
+  // atomic producer/consumer protocol equivalent to the uncontended lock
+  // below, which on every supported platform is a single CAS on each side.
+  // The lock is therefore kept, and the hot paths instead avoid work while
+  // holding it (see next(_:)).
   internal final class _Storage: @unchecked Sendable {
     typealias TerminationHandler = @Sendable (Continuation.Termination) -> Void
 
@@ -236,20 +246,31 @@ extension AsyncStream {
 
     func next(_ continuation: UnsafeContinuation<Element?, Never>) {
       lock()
-      state.continuations.append(continuation)
-      if state.pending.count > 0 {
-        let cont = state.continuations.removeFirst()
+      if state.continuations.isEmpty, state.pending.count > 0 {
+        // No other consumer is in line, so this continuation is served
+        // immediately; don't round-trip it through the waiter list, which
+        // costs an array append (and potentially an allocation) per element.
         let toSend = state.pending.removeFirst()
         unlock()
-        cont.resume(returning: toSend)
-      } else if state.terminal {
-        let cont = state.continuations.removeFirst()
+        continuation.resume(returning: toSend)
+      } else if state.continuations.isEmpty, state.terminal {
         unlock()
-        cont.resume(returning: nil)
+        continuation.resume(returning: nil)
       } else {
-        unlock()
+        state.continuations.append(continuation)
+        if state.pending.count > 0 {
+          let cont = state.continuations.removeFirst()
+          let toSend = state.pending.removeFirst()
+          unlock()
+          cont.resume(returning: toSend)
+        } else if state.terminal {
+          let cont = state.continuations.removeFirst()
+          unlock()
+          cont.resume(returning: nil)
+        } else {
+          unlock()
+        }
       }
-      
     }
     
     func next() async -> Element? {
@@ -0,0 +1,87 @@
+//===--- ConcurrencyCounters.cpp - Always-on concurrency counters ---------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Cheap, always-compiled-in event counters for the concurrency runtime.
+// See ConcurrencyCounters.h for the design rationale.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConcurrencyCounters.h"
+
+#include <atomic>
+#include <cassert>
+
+using namespace swift;
+using namespace swift::concurrency::counters;
+
+namespace {
+
+/// Number of counter stripes; must be a power of two. Threads are spread
+/// across stripes so that concurrent increments usually touch different
+/// cache lines.
+constexpr size_t NumStripes = 16;
+
+struct alignas(64) CounterStripe {
+  std::atomic<uint64_t> counts[NumCounters];
+};
+
+} // end anonymous namespace
+
+static CounterStripe Stripes[NumStripes];
+
+/// Pick the stripe for the current thread. We hash the address of a stack
+/// local: distinct threads' stacks are at least a stack size apart, so the
+/// high bits of the address discriminate threads well, without spending a
+/// TLS key or a platform thread-id query on every increment. A thread that
+/// occasionally crosses into a neighbouring stripe only costs a shared
+/// cache line for those increments; the totals stay exact.
+static CounterStripe &currentStripe() {
+  char marker;
+  auto bits = reinterpret_cast<uintptr_t>(&marker) >> 14;
+  return Stripes[(bits ^ (bits >> 9)) & (NumStripes - 1)];
+}
+
+void swift::concurrency::counters::increment(Counter counter) {
+  assert(counter < NumCounters);
+  currentStripe().counts[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+static const char *const CounterNames[] = {
+  "taskCreated",
+  "globalExecutorEnqueue",
+  "mainExecutorEnqueue",
+  "jobRun",
+  "actorContendedEnqueue",
+  nullptr
+};
+
+static_assert(sizeof(CounterNames) / sizeof(CounterNames[0]) ==
+                  NumCounters + 1,
+              "counter names out of sync with the Counter enum");
+
+uint64_t _swift_concurrency_getNumCounters() {
+  return NumCounters;
+}
+
+const char *const *_swift_concurrency_getCounterNames() {
+  return CounterNames;
+}
+
+void _swift_concurrency_getCounters(uint64_t *values) {
+  for (uint32_t i = 0; i < NumCounters; ++i) {
+    uint64_t total = 0;
+    for (size_t stripe = 0; stripe < NumStripes; ++stripe) {
+      total += Stripes[stripe].counts[i].load(std::memory_order_relaxed);
+    }
+    values[i] = total;
+  }
+}
@@ -0,0 +1,78 @@
+//===--- ConcurrencyCounters.h - Always-on concurrency counters -*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Cheap, always-compiled-in event counters for the concurrency runtime.
+//
+// Unlike the signpost tracing in Tracing.h (which can be compiled out) and
+// the opt-in counters in ../runtime/RuntimeInvocationsTracking.cpp, these
+// counters are always available so that production builds can observe task
+// creation rates, executor traffic, and actor contention without any
+// tracing infrastructure. An increment is a single relaxed atomic add on a
+// striped counter, so the cost is negligible whether or not anything ever
+// reads the values.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_CONCURRENCY_CONCURRENCYCOUNTERS_H
+#define SWIFT_CONCURRENCY_CONCURRENCYCOUNTERS_H
+
+#include "swift/Runtime/Config.h"
+
+#include <cstdint>
+
+namespace swift {
+namespace concurrency {
+namespace counters {
+
+/// The events counted by the concurrency runtime. The order defines the
+/// order of the values reported by _swift_concurrency_getCounters and of
+/// the names reported by _swift_concurrency_getCounterNames.
+enum Counter : uint32_t {
+  /// A task was created (swift_task_create and friends).
+  TaskCreated,
+  /// A job was enqueued on the global executor.
+  GlobalExecutorEnqueue,
+  /// A job was enqueued on the main executor.
+  MainExecutorEnqueue,
+  /// A job was handed to the runtime to run (swift_job_run). The
+  /// difference between the enqueue counters and this one approximates
+  /// the executor queue depth.
+  JobRun,
+  /// A job arrived at a default actor that could not take it immediately,
+  /// i.e. the actor was already running or scheduled.
+  ActorContendedEnqueue,
+
+  NumCounters
+};
+
+/// Count one occurrence of the given event on the current thread.
+void increment(Counter counter);
+
+} // namespace counters
+} // namespace concurrency
+} // namespace swift
+
+/// Return the number of counters maintained by the concurrency runtime.
+SWIFT_RUNTIME_EXPORT uint64_t _swift_concurrency_getNumCounters();
+
+/// Return the names of the counters, in the same order as the values
+/// written by _swift_concurrency_getCounters. The array is terminated by
+/// a null entry.
+SWIFT_RUNTIME_EXPORT const char *const *_swift_concurrency_getCounterNames();
+
+/// Aggregate the per-thread counters and store the totals into the given
+/// buffer, which must have room for _swift_concurrency_getNumCounters()
+/// values. The totals are monotonically non-decreasing; readers can
+/// compute rates by differencing successive snapshots.
+SWIFT_RUNTIME_EXPORT void _swift_concurrency_getCounters(uint64_t *values);
+
+#endif
@@ -19,6 +19,16 @@ public protocol Executor: AnyObject, Sendable {
 }
 
 /// A service that executes jobs.
+///
+/// An actor that wants control over *where* it runs -- a particular
+/// thread, queue, or core -- should provide a custom executor through
+/// its `unownedExecutor` property rather than expect placement hints
+/// from the runtime. The default executor deliberately has no
+/// affinity/pinning surface: it delegates thread management to the
+/// platform pool (Dispatch, where threads are not pinnable), and a
+/// per-actor "preferred core" hint could not be honored there. A
+/// custom `SerialExecutor` backed by a pinned thread gives the same
+/// cache-locality effect with ordinary, supported API.
 @available(SwiftStdlib 5.1, *)
 public protocol SerialExecutor: Executor {
   // This requirement is repeated here as a non-override so that we
@@ -56,6 +56,7 @@
 #include "../CompatibilityOverride/CompatibilityOverride.h"
 #include "swift/Runtime/Concurrency.h"
 #include "swift/Runtime/EnvironmentVariables.h"
+#include "ConcurrencyCounters.h"
 #include "TaskPrivate.h"
 #include "Error.h"
 
@@ -95,6 +96,8 @@ void swift::swift_task_enqueueGlobal(Job *job) {
   _swift_tsan_release(job);
 
   concurrency::trace::job_enqueue_global(job);
+  concurrency::counters::increment(
+      concurrency::counters::GlobalExecutorEnqueue);
 
   if (swift_task_enqueueGlobal_hook)
     swift_task_enqueueGlobal_hook(job, swift_task_enqueueGlobalImpl);
@@ -127,6 +130,7 @@ void swift::swift_task_enqueueGlobalWithDeadline(
 
 void swift::swift_task_enqueueMainExecutor(Job *job) {
   concurrency::trace::job_enqueue_main_executor(job);
+  concurrency::counters::increment(concurrency::counters::MainExecutorEnqueue);
   if (swift_task_enqueueMainExecutor_hook)
     swift_task_enqueueMainExecutor_hook(job,
                                         swift_task_enqueueMainExecutorImpl);
@@ -21,6 +21,7 @@
 #endif
 
 #include "../CompatibilityOverride/CompatibilityOverride.h"
+#include "ConcurrencyCounters.h"
 #include "Debug.h"
 #include "Error.h"
 #include "TaskGroupPrivate.h"
@@ -657,6 +658,8 @@ static AsyncTaskAndContext swift_task_create_commonImpl(
     TaskContinuationFunction *function, void *closureContext,
     size_t initialContextSize) {
 
+  concurrency::counters::increment(concurrency::counters::TaskCreated);
+
   TaskCreateFlags taskCreateFlags(rawTaskCreateFlags);
   JobFlags jobFlags(JobKind::Task, JobPriority::Unspecified);
 
@@ -846,7 +849,13 @@ static AsyncTaskAndContext swift_task_create_commonImpl(
     allocation = runInlineOption->getAllocation();
     initialSlabSize = runInlineBufferBytes - amountToAllocate;
   } else {
-    allocation = malloc(amountToAllocate);
+    // Co-allocate the initial allocator slab with the task. Short-lived
+    // tasks then pay a single malloc/free pair: their context allocations
+    // come out of the tail of the task's own block, and destroyTask frees
+    // both together. The allocator tears down in complete(), strictly
+    // before the task memory is freed, so the preallocated slab outlives
+    // every allocation made from it.
+    allocation = malloc(amountToAllocate + initialSlabSize);
   }
   SWIFT_TASK_DEBUG_LOG("allocate task %p, parent = %p, slab %u", allocation,
                        parent, initialSlabSize);
@@ -938,9 +947,10 @@ static AsyncTaskAndContext swift_task_create_commonImpl(
                             asyncLet         ? &completeTask
                             : closureContext ? &completeTaskWithClosure
                                              : &completeTaskAndRelease);
-  if ((asyncLet || (runInlineOption && runInlineOption->getAllocation())) &&
-      initialSlabSize > 0) {
-    assert(parent || (runInlineOption && runInlineOption->getAllocation()));
+  if (initialSlabSize > 0) {
+    // All allocation paths above provide an initial slab after the task:
+    // async-let and run-inline tasks carve it from their preallocated
+    // buffers, and ordinary tasks co-allocate it with the task itself.
     void *initialSlab = (char*)allocation + amountToAllocate;
     task->Private.initializeWithSlab(basePriority, initialSlab,
                                      initialSlabSize);
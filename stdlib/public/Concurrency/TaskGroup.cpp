@@ -20,8 +20,8 @@
 #include "TaskGroupPrivate.h"
 #include "TaskPrivate.h"
 #include "bitset"
-#include "queue" // TODO: remove and replace with usage of our mpsc queue
 #include "string"
+#include "llvm/ADT/SmallVector.h"
 #include "swift/ABI/HeapObject.h"
 #include "swift/ABI/Metadata.h"
 #include "swift/ABI/Task.h"
@@ -254,7 +254,13 @@ public:
 
   template<typename T>
   class NaiveQueue {
-    std::queue <T> queue;
+    /// FIFO over a small-vector: the inline elements cover the common case
+    /// of groups whose children are consumed about as fast as they
+    /// complete, so offering a result allocates nothing; large fan-out
+    /// spills to a single heap buffer. Dequeuing advances a head index
+    /// instead of shifting, and storage is reset once the queue drains.
+    llvm::SmallVector<T, 4> storage;
+    size_t head = 0;
 
   public:
     NaiveQueue() = default;
@@ -263,23 +269,25 @@ public:
 
     NaiveQueue &operator=(const NaiveQueue<T> &) = delete;
 
-    NaiveQueue(NaiveQueue<T> &&other) {
-      queue = std::move(other.queue);
+    NaiveQueue(NaiveQueue<T> &&other)
+        : storage(std::move(other.storage)), head(other.head) {
+      other.head = 0;
     }
 
-    virtual ~NaiveQueue() {}
-
     bool dequeue(T &output) {
-      if (queue.empty()) {
+      if (head == storage.size()) {
         return false;
       }
-      output = queue.front();
-      queue.pop();
+      output = storage[head++];
+      if (head == storage.size()) {
+        storage.clear();
+        head = 0;
+      }
       return true;
     }
 
     void enqueue(const T item) {
-      queue.push(item);
+      storage.push_back(item);
     }
   };
 
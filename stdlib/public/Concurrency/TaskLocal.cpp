@@ -117,6 +117,8 @@ static void swift_task_localValuePopImpl() {
     if (!hasRemainingBindings) {
       // We clean up eagerly, it may be that this non-swift-concurrency thread
       // never again will use task-locals, and as such we better remove the storage.
+      // All items are popped by now; destroy() just releases the lookup cache.
+      Local->destroy(/*task=*/nullptr);
       FallbackTaskLocalStorage::set(nullptr);
       free(Local);
     }
@@ -319,6 +321,11 @@ void TaskLocal::Item::destroy(AsyncTask *task) {
 }
 
 void TaskLocal::Storage::destroy(AsyncTask *task) {
+  if (lookupCache) {
+    free(lookupCache);
+    lookupCache = nullptr;
+  }
+
   auto item = head;
   head = nullptr;
   TaskLocal::Item *next;
@@ -352,12 +359,19 @@ void TaskLocal::Storage::pushValue(AsyncTask *task,
   auto item = Item::createLink(task, key, valueType);
   valueType->vw_initializeWithTake(item->getStoragePtr(), value);
   head = item;
+
+  // The new binding shadows whatever lookup we may have cached for this key.
+  invalidateLookupCache(key);
 }
 
 bool TaskLocal::Storage::popValue(AsyncTask *task) {
   assert(head && "attempted to pop value off empty task-local stack");
   auto old = head;
   head = head->getNext();
+
+  // Drop the cached lookup for this key before destroying the item;
+  // a subsequent read must re-discover any outer binding by walking.
+  invalidateLookupCache(old->key);
   old->destroy(task);
 
   /// if pointing at not-null next item, there are remaining bindings.
@@ -368,9 +382,28 @@ OpaqueValue* TaskLocal::Storage::getValue(AsyncTask *task,
                                           const HeapObject *key) {
   assert(key && "TaskLocal key must not be null.");
 
+  auto slot = lookupCacheSlot(key);
+  if (lookupCache) {
+    if (auto cached = lookupCache[slot]) {
+      if (cached->key == key) {
+        return cached->getStoragePtr();
+      }
+    }
+  }
+
   auto item = head;
   while (item) {
     if (item->key == key) {
+      // Remember the item so that repeated reads of the same key do not
+      // walk the chain again. Allocate the cache lazily; tasks which never
+      // read a task-local value do not pay for it.
+      if (!lookupCache) {
+        lookupCache = static_cast<TaskLocal::Item **>(
+            calloc(lookupCacheSlots, sizeof(TaskLocal::Item *)));
+      }
+      if (lookupCache) {
+        lookupCache[slot] = item;
+      }
       return item->getStoragePtr();
     }
 
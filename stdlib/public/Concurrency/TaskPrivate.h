@@ -530,7 +530,7 @@ struct AsyncTask::PrivateStorage {
   TaskAllocator Allocator;
 
   /// Storage for task-local values.
-  /// Currently one word.
+  /// Currently two words.
   TaskLocal::Storage Local;
 
   /// The top 32 bits of the task ID. The bottom 32 bits are in Job::Id.
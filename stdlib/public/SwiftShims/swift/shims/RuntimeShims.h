@@ -51,7 +51,33 @@ const char *_swift_stdlib_strtof16_clocale(const char *nptr, __fp16 *outResult);
 
 SWIFT_RUNTIME_STDLIB_API
 void _swift_stdlib_immortalize(void *obj);
-  
+
+/// Telemetry: record that a copy-on-write array buffer had to be copied
+/// because its storage was shared at mutation time.
+SWIFT_RUNTIME_STDLIB_API
+void _swift_stdlib_reportArrayCOWCopy(void);
+
+/// Telemetry: return the total number of copy-on-write array buffer copies
+/// recorded so far in this process. Monotonically non-decreasing; readers
+/// can difference successive snapshots to measure COW contention.
+SWIFT_RUNTIME_STDLIB_API
+__swift_uint64_t _swift_stdlib_getArrayCOWCopyCount(void);
+
+/// Telemetry: record that Cocoa-backed array storage was materialized into
+/// native contiguous storage, copying \p elementCount elements.
+SWIFT_RUNTIME_STDLIB_API
+void _swift_stdlib_reportBridgedArrayConversion(__swift_size_t elementCount);
+
+/// Telemetry: return the total number of Cocoa-to-native array storage
+/// conversions recorded so far in this process.
+SWIFT_RUNTIME_STDLIB_API
+__swift_uint64_t _swift_stdlib_getBridgedArrayConversionCount(void);
+
+/// Telemetry: return the total number of elements copied by the conversions
+/// counted by `_swift_stdlib_getBridgedArrayConversionCount`.
+SWIFT_RUNTIME_STDLIB_API
+__swift_uint64_t _swift_stdlib_getBridgedArrayConvertedElementCount(void);
+
 SWIFT_RUNTIME_STDLIB_API
 void _swift_stdlib_flockfile_stdout(void);
 SWIFT_RUNTIME_STDLIB_API
@@ -146,12 +146,22 @@ public struct AnyHashable {
   ///
   /// - Parameter base: A hashable value to wrap.
   @_specialize(where H == String)
+  @_specialize(where H == Int)
   public init<H: Hashable>(_ base: H) {
-    if H.self == String.self {
+    // `String` and `Bool` have no custom `AnyHashable` representation and no
+    // `Hashable`-conforming base type, so they can be boxed directly without
+    // consulting the conformance caches or calling into the runtime. Because
+    // `_ConcreteHashableBox` is a struct, these payloads are stored inline in
+    // the existential's buffer; no heap allocation occurs on this path.
+    //
+    // Numeric types must not take this shortcut: their custom representations
+    // canonicalize to Int64/UInt64 so that e.g. `AnyHashable(1 as Int)`
+    // compares equal to `AnyHashable(1 as Int8)` and `AnyHashable(1 as UInt)`.
+    if H.self == String.self || H.self == Bool.self {
       self.init(_box: _ConcreteHashableBox(base))
       return
     }
-    
+
     if let custom =
       (base as? _HasCustomAnyHashableRepresentation)?._toCustomAnyHashable() {
       self = custom
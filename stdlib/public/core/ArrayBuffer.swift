@@ -102,6 +102,18 @@ extension _ArrayBuffer {
   ///
   /// This function should only be used for internal sanity checks.
   /// To guard a buffer mutation, use `beginCOWMutation`.
+  ///
+  /// Note: the underlying uniqueness check is a single relaxed atomic load
+  /// of the refcount word plus a comparison -- there is no barrier or
+  /// read-modify-write involved. A "non-atomic check for thread-confined
+  /// objects" has been considered and rejected: the inline refcount word
+  /// has no spare bits for a thread-id tag (the side-table, immortality,
+  /// and deinit bits already claim the non-count bits), keeping such a tag
+  /// current would add work to every retain/release of every object, and
+  /// it could not make the check itself cheaper than the relaxed load it
+  /// already is. When this check shows up hot, the fix is hoisting it out
+  /// of the mutation loop, which the array semantics annotations enable
+  /// the optimizer to do.
   @inlinable
   internal mutating func isUniquelyReferenced() -> Bool {
     if !_isClassOrObjCExistential(Element.self) {
@@ -167,6 +179,12 @@ extension _ArrayBuffer {
   @inline(never)
   @_semantics("optimize.sil.specialize.owned2guarantee.never")
   internal __consuming func _consumeAndCreateNew() -> _ArrayBuffer {
+    // This entry point is only reached when a mutation found the storage
+    // shared, i.e. on the COW slow path; record it for the contention
+    // telemetry.
+    if #available(SwiftStdlib 5.8, *) {
+      _swift_stdlib_reportArrayCOWCopy()
+    }
     return _consumeAndCreateNew(bufferIsUnique: false,
                                 minimumCapacity: count,
                                 growForAppend: false)
@@ -131,6 +131,10 @@ internal struct _CocoaArrayWrapper: RandomAccessCollection {
     subRange bounds: Range<Int>,
     initializing target: UnsafeMutablePointer<AnyObject>
   ) -> UnsafeMutablePointer<AnyObject> {
+    // This is the funnel point for materializing Cocoa-backed storage into
+    // native contiguous storage, so it is where lazy bridging storms become
+    // visible.
+    _swift_stdlib_reportBridgedArrayConversion(bounds.count)
     return withExtendedLifetime(buffer) {
       let nsSubRange = SwiftShims._SwiftNSRange(
         location: bounds.lowerBound,
@@ -745,6 +745,12 @@ internal struct _ContiguousArrayBuffer<Element>: _ArrayBufferProtocol {
   @inline(never)
   @_semantics("optimize.sil.specialize.owned2guarantee.never")
   internal __consuming func _consumeAndCreateNew() -> _ContiguousArrayBuffer {
+    // This entry point is only reached when a mutation found the storage
+    // shared, i.e. on the COW slow path; record it for the contention
+    // telemetry.
+    if #available(SwiftStdlib 5.8, *) {
+      _swift_stdlib_reportArrayCOWCopy()
+    }
     return _consumeAndCreateNew(bufferIsUnique: false,
                                 minimumCapacity: count,
                                 growForAppend: false)
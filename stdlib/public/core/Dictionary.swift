@@ -28,6 +28,21 @@
 // `NSDictionary` in order to allow bridging `NSDictionary` to `Dictionary` in
 // `O(1)`.
 //
+// A third, inline linear-scan representation for tiny dictionaries (where
+// scanning a handful of keys beats hashing each lookup key) has been
+// considered and deliberately not added. `Dictionary`, `_Variant`, and
+// `_NativeDictionary` are frozen types whose accessors are inlined into
+// compiled client binaries, so those binaries hard-code the invariant that
+// native storage is a `__RawDictionaryStorage` hash table; teaching only
+// newer code about a third case would miscompile against older inlined
+// copies, making this an ABI break rather than an optimization. It would
+// also make every inlined fast path branch on the representation, taxing
+// the large-dictionary case, and hashing is already avoided where it
+// matters most: lookups hash once and probe linearly, and `Hasher` keys
+// with small fixed-width integer/string keys are only a few ns per hash.
+// Code with guaranteed-tiny collections and hot lookups is better served
+// by an array of key-value pairs, which gets the linear scan explicitly.
+//
 // Native dictionary storage uses a data structure like this::
 //
 //   struct Dictionary<K,V>
@@ -124,6 +124,9 @@ public class AnyKeyPath: Hashable, _AppendKeyPath {
   public var _kvcKeyPathString: String? {
     @_semantics("keypath.kvcKeyPathString")
     get {
+      // The KVC string field may instead hold a memoized stored-property
+      // offset; such key paths have no KVC string.
+      guard getOffsetFromStorage() == nil else { return nil }
       guard let ptr = _kvcKeyPathStringPtr else { return nil }
 
       return String(validatingUTF8: ptr)
@@ -190,6 +193,33 @@ public class AnyKeyPath: Hashable, _AppendKeyPath {
       }
     }
   }
+
+  // A key path whose components are all stored struct properties projects by
+  // adding a constant byte offset. When such a key path has no KVC string, we
+  // borrow the otherwise-unused KVC string field to memoize that offset,
+  // tagged as a negative pointer bit pattern so it can never be mistaken for
+  // a real string pointer. Projection then reduces to a single load instead
+  // of interpreting the component list. Only done on 64-bit targets, where
+  // negative bit patterns are never valid addresses; 32-bit targets keep
+  // interpreting components.
+
+  final internal func assignOffsetToStorage(offset: Int) {
+    guard MemoryLayout<Int>.size == 8, offset >= 0 else {
+      return
+    }
+    _kvcKeyPathStringPtr = UnsafePointer<CChar>(bitPattern: -offset - 1)
+  }
+
+  final internal func getOffsetFromStorage() -> Int? {
+    guard MemoryLayout<Int>.size == 8 else {
+      return nil
+    }
+    let value = Int(bitPattern: _kvcKeyPathStringPtr)
+    guard value < 0 else {
+      return nil
+    }
+    return -value - 1
+  }
 }
 
 /// A partially type-erased key path, from a concrete root type to any
@@ -246,6 +276,14 @@ public class KeyPath<Root, Value>: PartialKeyPath<Root> {
   
   @usableFromInline
   internal final func _projectReadOnly(from root: Root) -> Value {
+    // One-load fast path for stored-property key paths with a memoized
+    // offset.
+    if let offset = getOffsetFromStorage() {
+      return withUnsafeBytes(of: root) {
+        $0.load(fromByteOffset: offset, as: Value.self)
+      }
+    }
+
     // TODO: For perf, we could use a local growable buffer instead of Any
     var curBase: Any = root
     return withBuffer {
@@ -305,7 +343,14 @@ public class WritableKeyPath<Root, Value>: KeyPath<Root, Value> {
     var p = UnsafeRawPointer(base)
     var type: Any.Type = Root.self
     var keepAlive: AnyObject?
-    
+
+    // Stored-property key paths with a memoized offset project by pointer
+    // arithmetic; there is no reference prefix, so there is no owner.
+    if let offset = getOffsetFromStorage() {
+      let address = p.advanced(by: offset).assumingMemoryBound(to: Value.self)
+      return (pointer: UnsafeMutablePointer(mutating: address), owner: nil)
+    }
+
     return withBuffer {
       var buffer = $0
       
@@ -2307,7 +2352,11 @@ internal func _appendingKeyPaths<
       // KVC-compatible.
       let appendedKVCLength: Int, rootKVCLength: Int, leafKVCLength: Int
 
-      if let rootPtr = root._kvcKeyPathStringPtr,
+      // The KVC string field can hold a memoized stored-property offset
+      // instead of a string; such key paths are not KVC-compatible.
+      if root.getOffsetFromStorage() == nil,
+         leaf.getOffsetFromStorage() == nil,
+         let rootPtr = root._kvcKeyPathStringPtr,
          let leafPtr = leaf._kvcKeyPathStringPtr {
         rootKVCLength = Int(_swift_stdlib_strlen(rootPtr))
         leafKVCLength = Int(_swift_stdlib_strlen(leafPtr))
@@ -2420,6 +2469,13 @@ internal func _appendingKeyPaths<
         kvcStringBuffer.advanced(by: rootKVCLength + leafKVCLength + 1)
           .storeBytes(of: 0 /* '\0' */, as: CChar.self)
       }
+
+      // Memoize the net stored-property offset of the appended key path,
+      // just as instantiation does for compiled patterns.
+      if result._kvcKeyPathStringPtr == nil,
+         let offset = result._storedInlineOffset {
+        result.assignOffsetToStorage(offset: offset)
+      }
       return unsafeDowncast(result, to: Result.self)
     }
   }
@@ -2524,6 +2580,14 @@ public func _swift_getKeyPath(pattern: UnsafeMutableRawPointer,
       kvcStringPtr.assumingMemoryBound(to: CChar.self)
   }
 
+  // If the instantiated key path is a pure chain of stored struct properties
+  // and has no KVC string, memoize its net byte offset so projection becomes
+  // a single load.
+  if instance._kvcKeyPathStringPtr == nil,
+     let offset = instance._storedInlineOffset {
+    instance.assignOffsetToStorage(offset: offset)
+  }
+
   // If we can cache this instance as a shared instance, do so.
   if let oncePtr = oncePtr {
     // Try to replace a null pointer in the cache variable with the instance
@@ -168,6 +168,10 @@ where Self: RandomAccessCollection, Element: Comparable {
   /// - Complexity: O(*n* log *n*), where *n* is the length of the collection.
   @inlinable
   public mutating func sort() {
+    // Large contiguous buffers of fixed-width integers are sorted by an LSD
+    // radix sort instead of the comparison sort; see the discussion at
+    // _trySortIntegersByRadix.
+    if _trySortIntegersByRadix() { return }
     sort(by: <)
   }
 }
@@ -711,3 +715,147 @@ extension UnsafeMutableBufferPointer {
     }
   }
 }
+
+//===--- Radix sort for integer elements ----------------------------------===//
+
+extension MutableCollection where Self: RandomAccessCollection, Element: Comparable {
+  /// Attempts to sort the collection with a least-significant-digit radix
+  /// sort, returning `true` on success.
+  ///
+  /// The radix path applies only when the elements are fixed-width integers
+  /// stored contiguously, the ordering is the default ascending one (this is
+  /// only called from `sort()`), and the collection is large enough for the
+  /// per-pass bookkeeping to pay off; everything else stays on the
+  /// comparison sort. Stability is trivially preserved because equal
+  /// integers are indistinguishable. Floating-point elements are
+  /// deliberately excluded: `<` is not a strict weak ordering in the
+  /// presence of NaN, and a bitwise radix sort would impose a total order
+  /// that differs observably from what the comparison sort produces.
+  @_alwaysEmitIntoClient
+  internal mutating func _trySortIntegersByRadix() -> Bool {
+    // Below this size the comparison sort wins; histograms and the scratch
+    // buffer cost more than they save.
+    guard count >= 256 else { return false }
+
+    func sortAs<T: FixedWidthInteger & UnsignedInteger>(
+      _ type: T.Type, flippingSignBit: Bool
+    ) -> Bool {
+      let sorted: Void? = withContiguousMutableStorageIfAvailable { buffer in
+        buffer.withMemoryRebound(to: T.self) { b in
+          _lsdRadixSort(b, flippingSignBit: flippingSignBit)
+        }
+      }
+      return sorted != nil
+    }
+
+    // Signed integers are sorted as unsigned keys with the sign bit
+    // flipped, which maps the signed order onto the unsigned one.
+    if Element.self == Int.self {
+      return sortAs(UInt.self, flippingSignBit: true)
+    }
+    if Element.self == UInt.self {
+      return sortAs(UInt.self, flippingSignBit: false)
+    }
+    if Element.self == Int64.self {
+      return sortAs(UInt64.self, flippingSignBit: true)
+    }
+    if Element.self == UInt64.self {
+      return sortAs(UInt64.self, flippingSignBit: false)
+    }
+    if Element.self == Int32.self {
+      return sortAs(UInt32.self, flippingSignBit: true)
+    }
+    if Element.self == UInt32.self {
+      return sortAs(UInt32.self, flippingSignBit: false)
+    }
+    if Element.self == Int16.self {
+      return sortAs(UInt16.self, flippingSignBit: true)
+    }
+    if Element.self == UInt16.self {
+      return sortAs(UInt16.self, flippingSignBit: false)
+    }
+    if Element.self == Int8.self {
+      return sortAs(UInt8.self, flippingSignBit: true)
+    }
+    if Element.self == UInt8.self {
+      return sortAs(UInt8.self, flippingSignBit: false)
+    }
+    return false
+  }
+}
+
+/// Sorts a buffer of unsigned integers with a stable LSD radix sort, one
+/// byte per pass. If `flippingSignBit` is true, keys are relocated by
+/// flipping their sign bit before sorting and restored afterwards, which
+/// sorts the buffer in the two's-complement signed order.
+@_alwaysEmitIntoClient
+internal func _lsdRadixSort<T: FixedWidthInteger & UnsignedInteger>(
+  _ elements: UnsafeMutableBufferPointer<T>, flippingSignBit: Bool
+) {
+  let count = elements.count
+  if count < 2 { return }
+
+  let signMask: T = flippingSignBit ? T(1) &<< (T.bitWidth - 1) : 0
+  let digits = T.bitWidth / 8
+
+  let scratch = UnsafeMutableBufferPointer<T>.allocate(capacity: count)
+  defer { scratch.deallocate() }
+
+  // One 256-entry histogram per byte position, all filled in a single read
+  // pass.
+  let counts = UnsafeMutableBufferPointer<Int>.allocate(
+    capacity: digits &* 256)
+  defer { counts.deallocate() }
+  counts.initialize(repeating: 0)
+
+  for i in 0 ..< count {
+    let v = elements[i] ^ signMask
+    elements[i] = v
+    var d = 0
+    while d < digits {
+      counts[d &* 256 &+ Int((v &>> (d &* 8)) & 0xFF)] &+= 1
+      d &+= 1
+    }
+  }
+
+  var src = elements
+  var dst = scratch
+  for d in 0 ..< digits {
+    let base = d &* 256
+    // If every key has the same byte in this position, the pass would be
+    // the identity permutation; skip it. This makes keys with a narrow
+    // value range (a common shape for analytics columns) cost only the
+    // passes that discriminate.
+    let firstByte = Int((src[0] &>> (d &* 8)) & 0xFF)
+    if counts[base &+ firstByte] == count { continue }
+
+    // Turn the histogram into starting offsets.
+    var sum = 0
+    for b in 0 ..< 256 {
+      let c = counts[base &+ b]
+      counts[base &+ b] = sum
+      sum &+= c
+    }
+
+    for i in 0 ..< count {
+      let v = src[i]
+      let byte = base &+ Int((v &>> (d &* 8)) & 0xFF)
+      dst[counts[byte]] = v
+      counts[byte] &+= 1
+    }
+    swap(&src, &dst)
+  }
+
+  // An odd number of performed passes leaves the result in the scratch
+  // buffer; move it back.
+  if src.baseAddress != elements.baseAddress {
+    elements.baseAddress._unsafelyUnwrappedUnchecked.update(
+      from: src.baseAddress._unsafelyUnwrappedUnchecked, count: count)
+  }
+
+  if flippingSignBit {
+    for i in 0 ..< count {
+      elements[i] ^= signMask
+    }
+  }
+}
@@ -171,10 +171,24 @@ private func _stringCompareFastUTF8Abnormal(
     _findBoundary(utf8Right, before: diffIdx))
   _internalInvariant(boundaryIdx <= diffIdx)
 
-  return _stringCompareSlow(
-    UnsafeBufferPointer(rebasing: utf8Left[boundaryIdx...]),
-    UnsafeBufferPointer(rebasing: utf8Right[boundaryIdx...]),
-    expecting: expecting)
+  let leftSuffix = UnsafeBufferPointer(rebasing: utf8Left[boundaryIdx...])
+  let rightSuffix = UnsafeBufferPointer(rebasing: utf8Right[boundaryIdx...])
+
+  // Last chance to avoid the normalizer: the per-instance isNFC flag is
+  // conservative, so text that is in fact already NFC can end up here. If
+  // both suffixes pass the NFC quick check then their binary order is their
+  // canonical order, and we already know they diverge at `diffIdx`.
+  if leftSuffix.isNFCQuickCheck() && rightSuffix.isNFCQuickCheck() {
+    guard expecting == .less else {
+      _internalInvariant(expecting == .equal)
+      return false
+    }
+    return _lexicographicalCompare(
+      utf8Left[_unchecked: diffIdx], utf8Right[_unchecked: diffIdx],
+      expecting: .less)
+  }
+
+  return _stringCompareSlow(leftSuffix, rightSuffix, expecting: expecting)
 }
 
 @_effects(readonly)
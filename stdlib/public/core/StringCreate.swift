@@ -12,8 +12,11 @@
 // String Creation Helpers
 //===----------------------------------------------------------------------===//
 
-internal func _allASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
-  if input.isEmpty { return true }
+/// Returns the length of the leading run of ASCII bytes, i.e. `input.count`
+/// if the whole buffer is ASCII and otherwise the index of the first
+/// non-ASCII byte. Checks a word at a time after reaching alignment.
+internal func _asciiPrefixLength(_ input: UnsafeBufferPointer<UInt8>) -> Int {
+  if input.isEmpty { return 0 }
 
   // NOTE: Avoiding for-in syntax to avoid bounds checks
   //
@@ -30,7 +33,7 @@ internal func _allASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
   let byteASCIIMask = UInt8(truncatingIfNeeded: wordASCIIMask)
 
   while (address &+ i) % stride != 0 && i < count {
-    guard ptr[i] & byteASCIIMask == 0 else { return false }
+    guard ptr[i] & byteASCIIMask == 0 else { return i }
     i &+= 1
   }
 
@@ -38,15 +41,19 @@ internal func _allASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
     let word: UInt = UnsafePointer(
       bitPattern: address &+ i
     )._unsafelyUnwrappedUnchecked.pointee
-    guard word & wordASCIIMask == 0 else { return false }
+    guard word & wordASCIIMask == 0 else { break }
     i &+= stride
   }
 
   while i < count {
-    guard ptr[i] & byteASCIIMask == 0 else { return false }
+    guard ptr[i] & byteASCIIMask == 0 else { return i }
     i &+= 1
   }
-  return true
+  return count
+}
+
+internal func _allASCII(_ input: UnsafeBufferPointer<UInt8>) -> Bool {
+  return _asciiPrefixLength(input) == input.count
 }
 
 extension String {
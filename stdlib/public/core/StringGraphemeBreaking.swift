@@ -203,8 +203,28 @@ extension _StringGuts {
       return _foreignOpaqueCharacterStride(startingAt: i)
     }
 
-    let nextIdx = withFastUTF8 { utf8 in
-      nextBoundary(startingAt: i) { j in
+    let nextIdx = withFastUTF8 { utf8 -> Int in
+      // ASCII short-circuit: a printable ASCII scalar followed by another
+      // ASCII scalar is always a complete Character (no ASCII scalar can
+      // extend a preceding one), a control always ends its cluster (GB4),
+      // and CR-LF is the single two-scalar ASCII cluster. Only a printable
+      // followed by a non-ASCII scalar (e.g. a combining mark) needs the
+      // full rules, so mostly-ASCII text rarely consults the break
+      // property tables at all.
+      let cu = utf8[i]
+      if cu < 0x80 {
+        if _fastPath(cu >= 0x20 && cu != 0x7F) {
+          if i &+ 1 == utf8.count || utf8[i &+ 1] < 0x80 {
+            return i &+ 1
+          }
+        } else if cu == _CR, i &+ 1 < utf8.count, utf8[i &+ 1] == _LF {
+          return i &+ 2
+        } else {
+          // Other controls, a lone CR, or LF.
+          return i &+ 1
+        }
+      }
+      return nextBoundary(startingAt: i) { j in
         _internalInvariant(j >= 0)
         guard j < utf8.count else { return nil }
         let (scalar, len) = _decodeScalar(utf8, startingAt: j)
@@ -228,8 +248,27 @@ extension _StringGuts {
       return _foreignOpaqueCharacterStride(endingAt: i)
     }
 
-    let previousIdx = withFastUTF8 { utf8 in
-      previousBoundary(endingAt: i) { j in
+    let previousIdx = withFastUTF8 { utf8 -> Int in
+      // ASCII short-circuit, mirroring _opaqueCharacterStride(startingAt:):
+      // looking backwards, CR-LF is the only two-scalar ASCII cluster, a
+      // cluster ending in any other control is that control alone (GB5),
+      // and a printable ASCII scalar preceded by ASCII (or the string
+      // start) stands alone. A printable preceded by non-ASCII (e.g. a
+      // prepend scalar) still takes the full rules.
+      let cu = utf8[i &- 1]
+      if cu < 0x80 {
+        if cu == _LF, i &- 2 >= 0, utf8[i &- 2] == _CR {
+          return i &- 2
+        }
+        if cu < 0x20 || cu == 0x7F {
+          // Controls, a lone LF, and CR (which never precedes LF here).
+          return i &- 1
+        }
+        if i &- 1 == 0 || utf8[i &- 2] < 0x80 {
+          return i &- 1
+        }
+      }
+      return previousBoundary(endingAt: i) { j in
         _internalInvariant(j <= utf8.count)
         guard j > 0 else { return nil }
         let (scalar, len) = _decodeScalar(utf8, endingAt: j)
@@ -257,8 +296,22 @@ extension _StringGuts {
       return _foreignOpaqueCharacterStride(endingAt: i, in: bounds)
     }
 
-    let previousIdx = withFastUTF8 { utf8 in
-      previousBoundary(endingAt: i) { j in
+    let previousIdx = withFastUTF8 { utf8 -> Int in
+      // Same ASCII short-circuit as _opaqueCharacterStride(endingAt:), with
+      // the substring's lower bound playing the role of the string start.
+      let cu = utf8[i &- 1]
+      if cu < 0x80 {
+        if cu == _LF, i &- 2 >= bounds.lowerBound, utf8[i &- 2] == _CR {
+          return i &- 2
+        }
+        if cu < 0x20 || cu == 0x7F {
+          return i &- 1
+        }
+        if i &- 1 == bounds.lowerBound || utf8[i &- 2] < 0x80 {
+          return i &- 1
+        }
+      }
+      return previousBoundary(endingAt: i) { j in
         _internalInvariant(j <= bounds.upperBound)
         guard j > bounds.lowerBound else { return nil }
         let (scalar, len) = _decodeScalar(utf8, endingAt: j)
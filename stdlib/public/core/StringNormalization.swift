@@ -55,6 +55,42 @@ extension UnsafeBufferPointer where Element == UInt8 {
     return cu._isNFCStarter
   }
 
+  // Quick check whether the validly-encoded UTF-8 in this buffer is already
+  // in NFC, using the UAX #15 quick-check algorithm: every scalar must have
+  // NFC_QC == Yes and canonical combining classes must not decrease within a
+  // segment. Conservative in one direction only: a false result does not
+  // mean the text is unnormalized (NFC_QC == Maybe is treated as failure),
+  // but a true result guarantees the bytes are exactly the NFC form.
+  //
+  // - Precondition: The buffer starts on a normalization boundary.
+  internal func isNFCQuickCheck() -> Bool {
+    var lastCCC: UInt16 = 0
+    var idx = 0
+    while idx < count {
+      // Sub-300 latiny fast-path: such scalars have NFC_QC == Yes and CCC 0.
+      if self[_unchecked: idx] < 0xCC {
+        lastCCC = 0
+        idx &+= 1
+        continue
+      }
+
+      let (scalar, len) = _decodeScalar(self, startingAt: idx)
+      let normData = _swift_stdlib_getNormData(scalar.value)
+      if normData & 0x6 != 0 {
+        // NFC_QC is No or Maybe.
+        return false
+      }
+      let ccc = normData >> 3
+      if ccc != 0 && lastCCC > ccc {
+        // Combining marks are not in canonical order.
+        return false
+      }
+      lastCCC = ccc
+      idx &+= len
+    }
+    return true
+  }
+
   internal func isOnUnicodeScalarBoundary(_ offset: Int) -> Bool {
     guard offset < count else {
       _internalInvariant(offset == count)
@@ -32,12 +32,17 @@ extension UTF8ValidationResult: Equatable {}
 private struct UTF8ValidationError: Error {}
 
 internal func validateUTF8(_ buf: UnsafeBufferPointer<UInt8>) -> UTF8ValidationResult {
-  if _allASCII(buf) {
+  let asciiPrefixLength = _asciiPrefixLength(buf)
+  if asciiPrefixLength == buf.count {
     return .success(UTF8ExtraInfo(isASCII: true))
   }
 
-  var iter = buf.makeIterator()
-  var lastValidIndex = buf.startIndex
+  // The word-at-a-time scan above has already proven the prefix valid, so
+  // resume byte-wise validation at the first non-ASCII byte instead of
+  // re-walking the prefix. Mostly-ASCII content pays for its (typically
+  // short) non-ASCII runs only.
+  var iter = buf[asciiPrefixLength...].makeIterator()
+  var lastValidIndex = asciiPrefixLength
 
   @inline(__always) func guaranteeIn(_ f: (UInt8) -> Bool) throws {
     guard let cu = iter.next() else { throw UTF8ValidationError() }
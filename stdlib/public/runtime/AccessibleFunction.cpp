@@ -139,7 +139,13 @@ swift::runtime::swift_findAccessibleFunction(const char *targetNameStart,
 
   llvm::StringRef name{targetNameStart, targetNameLength};
 
-  // Look for an existing entry.
+  // Look for an existing entry. The linear section scan below only runs on a
+  // cache miss; steady-state remote-call dispatch hits this
+  // ConcurrentReadableHashMap, which is wait-free for readers. A prebuilt
+  // (e.g. perfect-hash) index over the records would have to be emitted by
+  // the linker across all input objects and registered per image; nothing in
+  // the record format or the image callbacks supports that today, and the
+  // one-time scan per unique target name amortizes to the same place.
   {
     auto snapshot = S.Cache.snapshot();
     if (auto E = snapshot.find(name))
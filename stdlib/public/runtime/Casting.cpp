@@ -35,6 +35,15 @@
 #include "swift/Threading/Mutex.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/PointerIntPair.h"
+// SWIFT_OBJC_INTEROP is the build variant that removes Objective-C bridging
+// from the cast machinery: with it off (every non-Darwin runtime build) all
+// of the bridging branches below compile to nothing. It cannot become a
+// process-start switch on Darwin, where interop is part of the platform ABI:
+// the runtime is a shared OS component, any process can acquire ObjC classes
+// through a late dlopen or a linked framework, and a process that promised
+// "no ObjC" and then saw one would miscast rather than bridge. Deployments
+// that statically link their own runtime and can actually keep that promise
+// should build it with interop disabled instead of patching branches.
 #if SWIFT_OBJC_INTEROP
 #include "swift/Runtime/ObjCBridge.h"
 #include "SwiftObject.h"
@@ -99,8 +108,9 @@ static void _buildNameForMetadata(const Metadata *type,
 #endif
 
   // Use the remangler to generate a mangled name from the type metadata.
-  
-  Demangle::Demangler Dem;
+  // Stack allocation keeps typical demanglings from touching malloc; the
+  // arena dies with the call.
+  StackAllocatedDemangler<1024> Dem;
   auto demangling = _swift_buildDemanglingForMetadata(type, Dem);
   if (demangling == nullptr) {
     result = "<<< invalid type >>>";
@@ -223,7 +233,7 @@ swift::swift_getMangledTypeName(const Metadata *type) {
     }
 
     // Build the mangled name.
-    Demangle::Demangler Dem;
+    StackAllocatedDemangler<1024> Dem;
     auto demangling = _swift_buildDemanglingForMetadata(type, Dem);
 
     if (demangling == nullptr) {
@@ -2212,6 +2212,20 @@ static tryCastFunctionType *selectCasterForDest(const Metadata *destType) {
 // This top-level driver provides the general flow for all casting
 // operations.  It recursively unwraps source and destination as it
 // searches for a suitable conversion.
+//
+// Note on memoizing (srcType, destType) pairs: a cache of "which path
+// succeeded last time" consulted ahead of this dispatch tree is unsound
+// for exactly the pairs that are hot in practice.  When the source is an
+// existential, an optional, AnyHashable, __SwiftValue, or Error, the
+// applicable path depends on the *value* being cast (the boxed dynamic
+// type, or whether the optional is nil), not just the static pair.  The
+// common `Any as? Concrete` pattern already resolves in two cheap steps:
+// a failed direct attempt, then existential unwrapping into the exact
+// srcType == destType move/copy at the top of this function.  The
+// genuinely expensive subproblems — conformance checks, superclass
+// walks, and bridging witness lookups — are cached per-type at lower
+// levels (the conformance cache, ObjCBridgeMemo, and the metadata
+// caches), where value-independence actually holds.
 static DynamicCastResult
 tryCast(
   OpaqueValue *destLocation, const Metadata *destType,
@@ -332,6 +332,15 @@ swift::swift_storeEnumTagMultiPayload(OpaqueValue *value,
   }
 }
 
+// Note: the tag-extraction "strategy" for a multi-payload enum is already
+// resolved at metadata instantiation and stored in the metadata --
+// getMultiPayloadLayout above is two field loads and a subtraction, not a
+// layout recomputation. The work per call beyond that is loadEnumElement of
+// the 1/2/4-byte tag area and a compare, which is as close to the inline
+// shift/mask sequence the compiler emits for fragile enums as a call-based
+// ABI can get; caching additional derived parameters in the metadata would
+// save nothing but the subtraction. Per-call cost for resilient enums is the
+// call itself, which is the price of resilience.
 unsigned
 swift::swift_getEnumCaseMultiPayload(const OpaqueValue *value,
                                      const EnumMetadata *enumType) {
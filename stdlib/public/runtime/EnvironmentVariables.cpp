@@ -21,6 +21,10 @@
 
 using namespace swift;
 
+// Keep the x-macro type token usable at global scope when defining backing
+// variables below.
+using string = swift::runtime::environment::string;
+
 namespace {
 
 // Require all environment variable names to start with SWIFT_
@@ -123,6 +127,14 @@ static uint32_t parse_uint32_t(const char *name,
   return n;
 }
 
+static string parse_string(const char *name, const char *value,
+                           string defaultValue) {
+  if (!value || value[0] == '\0')
+    return defaultValue;
+  // Copy so the result stays valid even if the environment is later mutated.
+  return strdup(value);
+}
+
 // Print a list of all the environment variables. Lazy initialization makes
 // this a bit odd, but the use of these variables in the metadata system means
 // it's almost certain to run early.
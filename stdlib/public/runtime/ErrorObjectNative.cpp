@@ -64,6 +64,17 @@ static const FullMetadata<HeapMetadata> ErrorMetadata{
   HeapMetadata(MetadataKind::ErrorObject),
 };
 
+// Error boxes come straight from the Swift heap allocator, and deliberately
+// so. A recycling pool keyed to the throwing thread doesn't fit the object's
+// lifecycle: a thrown box dies through swift_errorRelease on whatever thread
+// drops the last reference (swift_deallocError below only runs when
+// initialization of a box fails), so returning boxes to a per-thread free
+// list would need cross-thread handoff -- which is exactly the fast path a
+// modern malloc already provides. Boxes are also variably sized by the boxed
+// type, so a pool would have to be size-bucketed, again duplicating malloc.
+// Throw-heavy control flow is better served by errors whose representation
+// avoids boxing (e.g. class-constrained errors, which are retained rather
+// than boxed here).
 BoxPair
 swift::swift_allocError(const swift::Metadata *type,
                         const swift::WitnessTable *errorConformance,
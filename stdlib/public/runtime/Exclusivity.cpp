@@ -153,6 +153,17 @@ static void reportExclusivityConflict(ExclusivityFlags oldAction, void *oldPC,
   _swift_reportToDebugger(RuntimeErrorFlagFatal, message, &details);
 }
 
+// A note on the data structure: the access set is an intrusive list threaded
+// through the caller-provided ValueBuffers, which is part of the ABI -- the
+// compiler reserves exactly one buffer per access and hands us nothing else.
+// Replacing it with a hash table would require separate per-thread storage
+// plus a handle stored in the buffer, i.e. strictly more memory traffic per
+// access. The list is also almost always a handful of entries with LIFO
+// discipline (see the fast path in remove), so the walk below is a few
+// compares in practice; profiles that attribute large fractions of time to
+// dynamic enforcement are measuring the per-call cost (runtime call + TLS
+// lookup), which is addressed by promoting accesses to static enforcement in
+// the optimizer, not by restructuring this set.
 bool AccessSet::insert(Access *access, void *pc, void *pointer,
                        ExclusivityFlags flags) {
 #ifndef NDEBUG
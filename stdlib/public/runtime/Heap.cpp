@@ -83,6 +83,21 @@ static inline malloc_zone_t *DEFAULT_ZONE() {
 // i.e. 0 < alignment <= _minAllocationAlignment:
 //   The runtime may use either malloc or AlignedAlloc, and the standard library
 //   must deallocate using an identical alignment.
+//
+// Going straight to malloc here is deliberate; resist the temptation to
+// add a size-classed per-thread magazine layer in front of it. Modern
+// system allocators already keep per-thread caches for exactly the
+// 32-128 byte sizes class instances occupy (libmalloc's nano/magazine
+// allocators on Darwin, glibc's tcache, jemalloc/mimalloc elsewhere), so
+// a second layer mostly duplicates theirs while adding a cross-thread
+// return path we would have to get right ourselves — Swift objects are
+// routinely released on threads other than the allocating one. It would
+// also hide Swift allocations from malloc introspection (malloc_size,
+// leaks, MallocStackLogging) and from sanitizer interposition, which
+// tooling depends on. StackAllocator is not a counterexample: it serves
+// strictly scoped lifetimes where frames are freed in LIFO order on one
+// thread. If a platform's allocator underperforms, the supported fix is
+// to link a better malloc process-wide.
 void *swift::swift_slowAlloc(size_t size, size_t alignMask) {
   void *p;
   // This check also forces "default" alignment to use AlignedAlloc.
@@ -437,6 +437,14 @@ SWIFT_RUNTIME_EXPORT
 void (*SWIFT_RT_DECLARE_ENTRY _swift_release_n)(HeapObject *object,
                                                 uint32_t n) = _swift_release_n_;
 
+void swift::swift_release_many(HeapObject *const *objects, size_t count) {
+  // Dispatch through swift_release per element so compatibility overrides
+  // and refcount instrumentation observe every release; the savings here
+  // are the per-element cross-image runtime calls, not the decrements.
+  for (size_t i = 0; i < count; ++i)
+    swift_release(objects[i]);
+}
+
 void swift::swift_nonatomic_release_n(HeapObject *object, uint32_t n) {
   SWIFT_RT_TRACK_INVOCATION(object, swift_nonatomic_release_n);
   if (isValidPointerForNativeRetain(object))
@@ -41,6 +41,7 @@
 #include <cctype>
 #include <cinttypes>
 #include <condition_variable>
+#include <cstring>
 #include <new>
 #include <unordered_set>
 #include <vector>
@@ -6210,6 +6211,42 @@ static swift::atomic<PoolRange>
 AllocationPool{PoolRange{InitialAllocationPool.Pool,
                          sizeof(InitialAllocationPool.Pool)}};
 
+namespace {
+  /// The number of tags defined in MetadataAllocatorTags.def.  Tag values are
+  /// contiguous starting at zero, so this also bounds the valid tag range.
+  enum : unsigned {
+    NumMetadataAllocatorTags =
+#define TAG(name, value) 1 +
+#include "MetadataAllocatorTags.def"
+    0
+  };
+} // end anonymous namespace
+
+/// Always-on accounting for the metadata allocation arena, used to attribute
+/// runtime-internal RSS to its subsystems.  The totals are cumulative rather
+/// than live, which is the same thing for all practical purposes: pool pages
+/// are never returned, and Deallocate only rolls back the most recent
+/// allocation.
+static std::atomic<uint64_t> MetadataAllocatorPageCount{0};
+static std::atomic<uint64_t>
+    MetadataAllocatorTagBytes[NumMetadataAllocatorTags];
+
+static void recordTagBytes(uint16_t tag, size_t size) {
+  unsigned index = tag < NumMetadataAllocatorTags ? tag : 0;
+  MetadataAllocatorTagBytes[index].fetch_add(size,
+                                             std::memory_order_relaxed);
+}
+
+uint64_t swift::_swift_debug_getMetadataAllocatorPageCount() {
+  return MetadataAllocatorPageCount.load(std::memory_order_relaxed);
+}
+
+uint64_t swift::_swift_debug_getMetadataAllocatorTagBytes(uint16_t tag) {
+  if (tag >= NumMetadataAllocatorTags)
+    return 0;
+  return MetadataAllocatorTagBytes[tag].load(std::memory_order_relaxed);
+}
+
 bool swift::_swift_debug_metadataAllocationIterationEnabled = false;
 const void * const swift::_swift_debug_allocationPoolPointer = &AllocationPool;
 std::atomic<const void *> swift::_swift_debug_metadataAllocationBacktraceList;
@@ -6305,6 +6342,7 @@ void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
   if (size > PoolRange::MaxPoolAllocationSize) {
     void *allocation = swift_slowAlloc(size, alignment - 1);
     memsetScribble(allocation, size);
+    recordTagBytes(Tag, size);
     return allocation;
   }
 
@@ -6367,6 +6405,10 @@ void *MetadataAllocator::Allocate(size_t size, size_t alignment) {
       __msan_allocated_memory(allocation, sizeWithHeader);
       __asan_unpoison_memory_region(allocation, sizeWithHeader);
 
+      recordTagBytes(Tag, size);
+      if (allocatedNewPage)
+        MetadataAllocatorPageCount.fetch_add(1, std::memory_order_relaxed);
+
       if (SWIFT_UNLIKELY(_swift_debug_metadataAllocationIterationEnabled)) {
         AllocationHeader *header = (AllocationHeader *)allocation;
         header->Size = size;
@@ -6485,6 +6527,72 @@ void swift::verifyMangledNameRoundtrip(const Metadata *metadata) {
 }
 #endif
 
+static LazyMutex InstantiationLogLock;
+
+void swift::recordMetadataInstantiation(const Metadata *metadata) {
+  // Record instantiations when a special environment variable is set. Each
+  // cache entry passes through here once, on the thread that performed the
+  // allocation, so the log contains one line per instantiated record.
+  const char *path =
+      runtime::environment::SWIFT_DEBUG_METADATA_INSTANTIATION_LOG();
+  if (SWIFT_LIKELY(!path))
+    return;
+  if (!metadata)
+    return;
+
+  auto name = swift_getMangledTypeName(metadata);
+  if (name.length == 0)
+    return;
+
+  LazyMutex::ScopedLock guard(InstantiationLogLock);
+  static FILE *logFile = fopen(path, "a");
+  if (!logFile)
+    return;
+  fprintf(logFile, "%.*s\n", (int)name.length, name.data);
+  fflush(logFile);
+}
+
+/// Replay a list of newline-separated mangled type names, typically produced
+/// by SWIFT_DEBUG_METADATA_INSTANTIATION_LOG, resolving each to complete
+/// metadata. Call this early in the process, from whatever thread is
+/// convenient, to move instantiation cost off latency-sensitive paths; the
+/// metadata caches make concurrent instantiation safe. Unresolvable lines
+/// (e.g. names from a binary that has since changed) are skipped. Returns the
+/// number of names successfully resolved.
+SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_SPI
+size_t swift_prewarmTypeMetadata(const char *namesStart, size_t namesLength) {
+  size_t numResolved = 0;
+  const char *end = namesStart + namesLength;
+  for (const char *line = namesStart; line < end;) {
+    auto *newline = static_cast<const char *>(
+        memchr(line, '\n', end - line));
+    const char *lineEnd = newline ? newline : end;
+    llvm::StringRef name(line, lineEnd - line);
+    line = lineEnd + 1;
+
+    // Same hygiene as swift_stdlib_getTypeByMangledNameUntrusted: ignore
+    // blank lines and reject control characters rather than letting them
+    // reach the demangler.
+    if (name.empty())
+      continue;
+    bool hasControlChars = false;
+    for (char c : name) {
+      if (c >= '\x01' && c <= '\x1F') {
+        hasControlChars = true;
+        break;
+      }
+    }
+    if (hasControlChars)
+      continue;
+
+    auto result = swift_getTypeByMangledName(MetadataState::Complete, name,
+                                             nullptr, {}, {});
+    if (result.getType().getMetadata())
+      ++numResolved;
+  }
+  return numResolved;
+}
+
 const TypeContextDescriptor *swift::swift_getTypeContextDescriptor(const Metadata *type) {
     return type->getTypeContextDescriptor();
 }
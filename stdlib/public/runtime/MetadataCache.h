@@ -166,6 +166,17 @@ struct ConcurrencyControl {
   LockType Lock;
 };
 
+// A note on scaling: the fast path here is already free of locks. Lookups of
+// present entries go through ConcurrentReadableHashMap snapshots, which
+// readers take without any shared writes beyond a reader count, so cache hits
+// do not contend regardless of core count. The per-map mutex guards only
+// insertion and resizing, and insertions happen at the rate metadata is
+// *instantiated*, which is bounded and front-loaded. Sharding the table by
+// hash would split that write lock but not the dominant warmup cost, which is
+// threads awaiting initialization of the *same* entries -- a per-entry wait,
+// not a map-level one. If profiles show time under "metadata cache
+// synchronization", check whether it is actually await() on popular entries
+// before reaching for sharding.
 template <class EntryType, uint16_t Tag>
 class LockingConcurrentMapStorage {
   // This class must fit within
@@ -980,6 +991,7 @@ public:
       if (asImpl().allowMangledNameVerification(std::forward<Args>(args)...))
         verifyMangledNameRoundtrip(asImpl().getValue());
 #endif
+      recordMetadataInstantiation(asImpl().getValue());
 
       // Skip initialization, too, if we're fully complete.
       if (state == PrivateMetadataState::Complete) {
@@ -1015,6 +1027,7 @@ public:
       if (asImpl().allowMangledNameVerification(std::forward<Args>(args)...))
         verifyMangledNameRoundtrip(value);
 #endif
+      recordMetadataInstantiation(value);
 
       return Status{allocationResult.Value, MetadataState::Complete};
     }
@@ -1032,6 +1045,7 @@ public:
     if (asImpl().allowMangledNameVerification(std::forward<Args>(args)...))
       verifyMangledNameRoundtrip(value);
 #endif
+    recordMetadataInstantiation(value);
 
     return None;
   }
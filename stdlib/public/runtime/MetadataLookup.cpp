@@ -54,6 +54,13 @@ using namespace reflection;
 #endif
 
 /// A Demangler suitable for resolving runtime type metadata strings.
+///
+/// Prefer StackAllocatedDemangler as the base at call sites: the node arena
+/// then lives in the caller's frame and typical demanglings never touch
+/// malloc. Nested demanglers can share an arena with an enclosing one via
+/// NodeFactory::providePreallocatedMemory. Both give the allocation reuse of
+/// a persistent per-thread arena without pinning slabs for the process
+/// lifetime on every thread that ever demangled.
 template <class Base = Demangler>
 class DemanglerForRuntimeTypeResolution : public Base {
 public:
@@ -566,7 +573,8 @@ swift::_contextDescriptorMatchesMangling(const ContextDescriptor *context,
       
       // Check that the context being extended matches as well.
       auto extendedContextNode = node->getChild(1);
-      DemanglerForRuntimeTypeResolution<> demangler;
+      DemanglerForRuntimeTypeResolution<StackAllocatedDemangler<1024>>
+          demangler;
 
       auto extendedDescriptorFromNode =
         _findContextDescriptor(extendedContextNode, demangler);
@@ -2014,6 +2022,52 @@ swift_getTypeByMangledNameInContextInMetadataState(
     }).getType().getMetadata();
 }
 
+namespace {
+/// Cache for complete, substitution-free mangled-name resolutions, as
+/// performed by swift_stdlib_getTypeByMangledNameUntrusted. Keyed by the
+/// mangled bytes, which are a stable key here because the untrusted path
+/// rejects symbolic references; entries are immutable after publication and
+/// reads are lock-free. Only successful resolutions are cached: a failing
+/// name can begin resolving when another image is loaded or an Objective-C
+/// class is registered, and there is no invalidation signal that covers
+/// both, so negative results would be able to go stale.
+struct MangledNameResolutionCacheEntry {
+private:
+  const char *Name;
+  size_t NameLength;
+  const Metadata *Resolved;
+
+public:
+  MangledNameResolutionCacheEntry(const llvm::StringRef name,
+                                  const Metadata *resolved)
+      : Resolved(resolved) {
+    char *nameCopy = reinterpret_cast<char *>(malloc(name.size()));
+    memcpy(nameCopy, name.data(), name.size());
+    Name = nameCopy;
+    NameLength = name.size();
+  }
+
+  const Metadata *getResolved() const { return Resolved; }
+
+  bool matchesKey(llvm::StringRef aName) {
+    return aName == llvm::StringRef{Name, NameLength};
+  }
+
+  friend llvm::hash_code
+  hash_value(const MangledNameResolutionCacheEntry &value) {
+    return hash_value(llvm::StringRef{value.Name, value.NameLength});
+  }
+
+  template <class... T>
+  static size_t getExtraAllocationSize(T &&... ignored) {
+    return 0;
+  }
+};
+} // end anonymous namespace
+
+static Lazy<ConcurrentReadableHashMap<MangledNameResolutionCacheEntry>>
+    MangledNameResolutionCache;
+
 /// Demangle a mangled name, but don't allow symbolic references.
 SWIFT_CC(swift) SWIFT_RUNTIME_STDLIB_INTERNAL
 const Metadata *_Nullable
@@ -2025,8 +2079,26 @@ swift_stdlib_getTypeByMangledNameUntrusted(const char *typeNameStart,
       return nullptr;
   }
 
-  return swift_getTypeByMangledName(MetadataState::Complete, typeName, nullptr,
-                                    {}, {}).getType().getMetadata();
+  auto &cache = MangledNameResolutionCache.get();
+  {
+    auto snapshot = cache.snapshot();
+    if (auto *entry = snapshot.find(typeName))
+      return entry->getResolved();
+  }
+
+  auto *metadata = swift_getTypeByMangledName(MetadataState::Complete, typeName,
+                                              nullptr, {}, {})
+                       .getType()
+                       .getMetadata();
+  if (metadata)
+    cache.getOrInsert(
+        typeName, [&](MangledNameResolutionCacheEntry *entry, bool created) {
+          if (created)
+            ::new (entry)
+                MangledNameResolutionCacheEntry(typeName, metadata);
+          return true;
+        });
+  return metadata;
 }
 
 // ==== Function metadata functions ----------------------------------------------
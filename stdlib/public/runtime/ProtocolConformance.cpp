@@ -26,7 +26,9 @@
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/Metadata.h"
 #include "swift/Basic/Unreachable.h"
+#include "swift/Threading/Mutex.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
 #include "../CompatibilityOverride/CompatibilityOverride.h"
 #include "ImageInspection.h"
 #include "Private.h"
@@ -414,6 +416,23 @@ struct ConformanceState {
   ConcurrentReadableArray<ConformanceSection> SectionsToScan;
   bool scanSectionsBackwards;
 
+  /// A lazily built index from protocol descriptor to the conformance
+  /// records naming that protocol, in registration order. A conformance
+  /// cache miss used to rescan every record in every registered section;
+  /// in processes with tens of thousands of records that linear walk
+  /// dominated first-touch dynamic casts. The index visits exactly the
+  /// records the full scan would have, in the same order, so lookup
+  /// semantics (including reverse iteration for legacy bincompat) are
+  /// unchanged.
+  Mutex ProtocolIndexLock;
+  llvm::DenseMap<const ProtocolDescriptor *,
+                 std::vector<const ProtocolConformanceDescriptor *>>
+      ProtocolIndex;
+
+  /// The number of sections from SectionsToScan that have been merged into
+  /// ProtocolIndex. Guarded by ProtocolIndexLock.
+  size_t SectionsIndexed = 0;
+
 #if USE_DYLD_SHARED_CACHE_CONFORMANCE_TABLES
   uintptr_t dyldSharedCacheStart;
   uintptr_t dyldSharedCacheEnd;
@@ -471,6 +490,29 @@ struct ConformanceState {
     initializeProtocolConformanceLookup();
   }
 
+  /// Copy the conformance records for \p protocol into \p results, first
+  /// merging any sections registered since the last call into the index.
+  /// Returns the number of sections covered by the results, suitable for
+  /// passing to cacheResult. Results are copied out so that callers do not
+  /// hold ProtocolIndexLock while matching types or instantiating witness
+  /// tables.
+  size_t getConformanceRecords(
+      const ProtocolDescriptor *protocol,
+      llvm::SmallVectorImpl<const ProtocolConformanceDescriptor *> &results) {
+    Mutex::ScopedLock guard(ProtocolIndexLock);
+    auto snapshot = SectionsToScan.snapshot();
+    for (size_t i = SectionsIndexed, e = snapshot.count(); i < e; ++i) {
+      for (const auto &record : snapshot.begin()[i])
+        ProtocolIndex[record.get()->getProtocol()].push_back(record.get());
+    }
+    SectionsIndexed = snapshot.count();
+
+    auto found = ProtocolIndex.find(protocol);
+    if (found != ProtocolIndex.end())
+      results.append(found->second.begin(), found->second.end());
+    return SectionsIndexed;
+  }
+
   void cacheResult(const Metadata *type, const ProtocolDescriptor *proto,
                    const WitnessTable *witness, size_t sectionsCount) {
     Cache.getOrInsert(ConformanceCacheKey(type, proto),
@@ -1049,47 +1091,38 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
     return {witness, false};
   }
 
-  // Scan conformance records.
+  // Scan the conformance records for this protocol. The per-protocol index
+  // replaces a linear walk over every record in every registered section.
   llvm::SmallDenseMap<const Metadata *, const WitnessTable *> foundWitnesses;
-  auto processSection = [&](const ConformanceSection &section) {
-    // Eagerly pull records for nondependent witnesses into our cache.
-    auto processDescriptor = [&](const ProtocolConformanceDescriptor &descriptor) {
-      // We only care about conformances for this protocol.
-      if (descriptor.getProtocol() != protocol)
-        return;
 
-      // If there's a matching type, record the positive result and return it.
-      // The matching type is exact, so they can't go stale, and we should
-      // always cache them.
-      ConformanceCandidate candidate(descriptor);
-      const Metadata *matchingType;
-      llvm::Optional<MetadataState> finalState;
-      std::tie(matchingType, finalState) =
-          candidate.getMatchingType(type, instantiateSuperclassMetadata);
-      noteFinalMetadataState(finalState);
-      if (matchingType) {
-        auto witness = descriptor.getWitnessTable(matchingType);
-        C.cacheResult(matchingType, protocol, witness, /*always cache*/ 0);
-        foundWitnesses.insert({matchingType, witness});
-      }
-    };
-
-    if (C.scanSectionsBackwards) {
-      for (const auto &record : llvm::reverse(section))
-        processDescriptor(*record.get());
-    } else {
-      for (const auto &record : section)
-        processDescriptor(*record.get());
+  // Eagerly pull records for nondependent witnesses into our cache.
+  auto processDescriptor = [&](const ProtocolConformanceDescriptor &descriptor) {
+    // If there's a matching type, record the positive result and return it.
+    // The matching type is exact, so they can't go stale, and we should
+    // always cache them.
+    ConformanceCandidate candidate(descriptor);
+    const Metadata *matchingType;
+    llvm::Optional<MetadataState> finalState;
+    std::tie(matchingType, finalState) =
+        candidate.getMatchingType(type, instantiateSuperclassMetadata);
+    noteFinalMetadataState(finalState);
+    if (matchingType) {
+      auto witness = descriptor.getWitnessTable(matchingType);
+      C.cacheResult(matchingType, protocol, witness, /*always cache*/ 0);
+      foundWitnesses.insert({matchingType, witness});
     }
   };
 
-  auto snapshot = C.SectionsToScan.snapshot();
+  // The index stores records in forward registration order, so reversing
+  // the flat list reproduces the legacy backwards section-and-record scan.
+  llvm::SmallVector<const ProtocolConformanceDescriptor *, 8> matchingRecords;
+  size_t sectionsCount = C.getConformanceRecords(protocol, matchingRecords);
   if (C.scanSectionsBackwards) {
-    for (auto &section : llvm::reverse(snapshot))
-      processSection(section);
+    for (const auto *descriptor : llvm::reverse(matchingRecords))
+      processDescriptor(*descriptor);
   } else {
-    for (auto &section : snapshot)
-      processSection(section);
+    for (const auto *descriptor : matchingRecords)
+      processDescriptor(*descriptor);
   }
 
   // Find the most specific conformance that was scanned.
@@ -1125,7 +1158,7 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
     // Do not cache negative results if there were uninstantiated superclasses
     // we didn't search. They might have a conformance that will be found later.
     if (foundWitness || !hasUninstantiatedSuperclass)
-      C.cacheResult(type, protocol, foundWitness, snapshot.count());
+      C.cacheResult(type, protocol, foundWitness, sectionsCount);
 
   // A negative result can be overridden by a result from dyld.
   if (!foundWitness) {
@@ -764,6 +764,34 @@ size_t swift_dtoa_optimal_double(double d, char *dest, size_t length) {
 }
 #endif
 
+// Format a contiguous array of binary64 values into one caller-provided
+// buffer.  Each value is rendered exactly as by
+// swift_dtoa_optimal_binary64_p; the NUL each rendering ends with is kept
+// in place, so the buffer holds `i` consecutive NUL-terminated strings.
+// Formatting stops when the remaining space cannot hold the next value.
+// Returns the number of values formatted; if `usedLength` is non-NULL it
+// receives the total bytes written, including the terminating NULs.
+size_t swift_dtoa_optimal_binary64_batch(const void *values, size_t count,
+                                         char *dest, size_t length,
+                                         size_t *usedLength)
+{
+    const char *source = (const char *)values;
+    size_t used = 0;
+    size_t i = 0;
+    for (; i < count; i++) {
+        size_t n = swift_dtoa_optimal_binary64_p(source + i * 8,
+                                                 dest + used, length - used);
+        if (n == 0) {
+            break;
+        }
+        used += n + 1; // Step over this value's NUL terminator.
+    }
+    if (usedLength != NULL) {
+        *usedLength = used;
+    }
+    return i;
+}
+
 // Format an IEEE 754 double-precision binary64 format floating-point number.
 
 // The calling convention here assumes that C `double` is this format,
@@ -50,6 +50,15 @@ namespace {
 static swift::MetadataSections sections{};
 }
 
+// For a statically linked binary this constructor *is* the merged section
+// directory: the linker concatenates every object's swift5_* sections into
+// one contiguous range per section, so the whole program registers a single
+// immutable MetadataSections record before main runs. Nothing on this path
+// consults dl_iterate_phdr, and the registry appended to by
+// swift_addNewDSOImage is a ConcurrentReadableArray whose readers take no
+// lock. First-cast latency in multi-threaded startup comes from populating
+// the conformance cache (every thread missing on the same types), not from
+// discovering images.
 __attribute__((__constructor__))
 static void swift_image_constructor() {
 #define SWIFT_SECTION_RANGE(name)                                              \
@@ -153,6 +153,15 @@ class WeakReferenceBits {
 };
 
 
+// Concurrency note: there is no shared lock anywhere in the native weak
+// reference scheme, so contention cannot couple unrelated objects. Each
+// object lazily gets its own HeapObjectSideTableEntry (installed by CAS on
+// the object's inline refcount word), and a weak load is an atomic load of
+// this reference's bits followed by a tryRetain CAS on that entry's own
+// refcount -- already the lock-free published-pointer fast path. The only
+// spinning is on the per-reference use bit in WeakReferenceBits while *this
+// particular location* is mid-copy. Sharding an array of locks by object
+// address would introduce the cross-object coupling this design avoids.
 class WeakReference {
   union {
     std::atomic<WeakReferenceBits> nativeValue;
@@ -57,6 +57,7 @@
 #endif
 #endif // SWIFT_STDLIB_HAS_LOCALE
 
+#include <atomic>
 #include <limits>
 #include <thread>
 
@@ -481,6 +482,40 @@ int _swift_stdlib_putc_stderr(int C) {
   return putc(C, stderr);
 }
 
+// A single relaxed counter is sufficient here: the copy path it measures
+// already performs an allocation and an element-wise copy, so the increment
+// is noise, and contended increments are themselves a signal of heavy COW
+// traffic.
+static std::atomic<uint64_t> ArrayCOWCopyCount{0};
+
+void _swift_stdlib_reportArrayCOWCopy() {
+  ArrayCOWCopyCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t _swift_stdlib_getArrayCOWCopyCount() {
+  return ArrayCOWCopyCount.load(std::memory_order_relaxed);
+}
+
+// Tracks materializations of Cocoa-backed array storage into native
+// contiguous storage. Each conversion already makes a bulk getObjects call
+// and retains every element, so the two relaxed increments are noise.
+static std::atomic<uint64_t> BridgedArrayConversionCount{0};
+static std::atomic<uint64_t> BridgedArrayConvertedElementCount{0};
+
+void _swift_stdlib_reportBridgedArrayConversion(size_t elementCount) {
+  BridgedArrayConversionCount.fetch_add(1, std::memory_order_relaxed);
+  BridgedArrayConvertedElementCount.fetch_add(elementCount,
+                                              std::memory_order_relaxed);
+}
+
+uint64_t _swift_stdlib_getBridgedArrayConversionCount() {
+  return BridgedArrayConversionCount.load(std::memory_order_relaxed);
+}
+
+uint64_t _swift_stdlib_getBridgedArrayConvertedElementCount() {
+  return BridgedArrayConvertedElementCount.load(std::memory_order_relaxed);
+}
+
 size_t _swift_stdlib_getHardwareConcurrency() {
 #ifdef SWIFT_THREADING_NONE
   return 1;
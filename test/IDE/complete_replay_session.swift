@@ -0,0 +1,36 @@
+// RUN: %empty-directory(%t)
+// RUN: split-file %s %t
+
+// RUN: %target-swift-ide-test -code-completion-replay -source-filename %t/session.txt | %FileCheck %s
+
+// The second snapshot only differs from the first inside a function body, so
+// the second request should hit the ASTContext reuse fast path.
+
+// CHECK: Request 0: token=A; results={{[1-9][0-9]*}}; elapsed={{[0-9]+}} usec
+// CHECK: Request 1: token=B; results={{[1-9][0-9]*}}; elapsed={{[0-9]+}} usec (reusing ASTContext)
+// CHECK: Replay summary: requests=2; failed=0; min={{[0-9]+}}; p50={{[0-9]+}}; p90={{[0-9]+}}; max={{[0-9]+}}; mean={{[0-9]+}} (usec)
+
+//--- session.txt
+# Recorded session: two completions in test(s:), with an edit in between.
+v0.swift A
+v1.swift B
+
+//--- v0.swift
+struct S {
+  var x: Int
+  func foo() {}
+}
+func test(s: S) {
+  s.#^A^#
+}
+
+//--- v1.swift
+struct S {
+  var x: Int
+  func foo() {}
+}
+func test(s: S) {
+  let y = s.x
+  s.#^B^#
+  _ = y
+}
@@ -0,0 +1,30 @@
+// Tests that under -enable-split-cold-code, LLVM's hot/cold splitting pass
+// runs and outlines unreachable-terminated cold paths into `.cold` functions.
+
+// RUN: %target-swift-frontend -O -enable-split-cold-code -emit-ir %s -o - | %FileCheck %s
+
+// The pass only runs when explicitly requested.
+// RUN: %target-swift-frontend -O -emit-ir %s -o - | %FileCheck %s --check-prefix=CHECK-DISABLED
+
+@inline(never)
+func diagnosticMessage(_ x: Int) -> String {
+  return "unexpected negative value \(x) (scaled: \(x &* 3))"
+}
+
+public func test(_ x: Int) -> Int {
+  if x < 0 {
+    fatalError(diagnosticMessage(x))
+  }
+  return x &+ 1
+}
+
+// The hot entry point tail-calls into the outlined cold continuation...
+// CHECK-LABEL: define {{.*}}swiftcc {{i[0-9]+}} @"$s4main4testyS2iF"
+// CHECK: call {{.*}}@"$s4main4testyS2iF.cold.1"
+
+// ...which is marked cold and optimized for size so the linker can group it
+// away from the hot working set.
+// CHECK: define {{.*}}@"$s4main4testyS2iF.cold.1"({{.*}}) #[[COLD_ATTRS:[0-9]+]]
+// CHECK: attributes #[[COLD_ATTRS]] = { {{.*}}cold{{.*}}minsize
+
+// CHECK-DISABLED-NOT: .cold.
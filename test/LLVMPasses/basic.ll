@@ -423,6 +423,40 @@ entry:
   ret void
 }
 
+; CHECK-LABEL: @releasemotion_straightline_blocks
+; CHECK-NOT: swift_retain
+; CHECK-NOT: swift_release
+; CHECK: ret
+define void @releasemotion_straightline_blocks(%swift.refcounted* %P) {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* %P)
+  br label %next
+
+next:
+  tail call void @swift_release(%swift.refcounted* %P) nounwind
+  ret void
+}
+
+; The release must not be hoisted past a conditional branch; the retain on the
+; other path would be unbalanced.
+; CHECK-LABEL: @releasemotion_conditional_blocks
+; CHECK: swift_retain
+; CHECK: swift_release
+; CHECK: ret
+define void @releasemotion_conditional_blocks(%swift.refcounted* %P, i1 %c) {
+entry:
+  tail call %swift.refcounted* @swift_retain(%swift.refcounted* %P)
+  br i1 %c, label %merge, label %other
+
+other:
+  call void @unknown_func()
+  br label %merge
+
+merge:
+  tail call void @swift_release(%swift.refcounted* %P) nounwind
+  ret void
+}
+
 !llvm.dbg.cu = !{!1}
 !llvm.module.flags = !{!4}
 
@@ -1256,6 +1256,17 @@ swift::ide::CodeCompletionCache &SwiftCompletionCache::getCache() {
 }
 SwiftCompletionCache::~SwiftCompletionCache() {}
 
+// This on-disk cache is also what makes crash recovery cheap; it does not
+// need a shared-memory segment. The cache files survive a service-process
+// crash, the respawned service mmaps them back in
+// (OnDiskCodeCompletionCache::getFromFile), and on a warm machine those pages
+// are still in the OS page cache, so the re-attach is a validation pass
+// rather than a re-read. The same holds for .swiftmodule buffers, which are
+// memory-mapped from disk by the serialization layer. What cannot be shared
+// across processes is the deserialized state built on top of those buffers
+// (ModuleFileSharedCore, ASTContext): it is a pointer-rich object graph with
+// no relocation story, so a respawned process must rebuild it regardless of
+// where the raw bytes live.
 void SwiftLangSupport::codeCompleteCacheOnDisk(StringRef path) {
   ThreadSafeRefCntPtr<SwiftCompletionCache> newCache(new SwiftCompletionCache);
   newCache->onDisk = std::make_unique<ide::OnDiskCodeCompletionCache>(path);
@@ -1904,6 +1904,17 @@ void SwiftLangSupport::getCursorInfo(
     return;
   }
 
+  // An index-store-backed fast path (answering from occurrence records and
+  // swiftmodule doc tables without an AST) has been considered and rejected
+  // for this entry point. The index describes the last *build* of the file,
+  // while cursor info is queried against the editor's current buffer, so a
+  // byte offset can only be trusted after mapping through the edits since
+  // that build -- machinery SourceKit doesn't have. The index also records
+  // USRs and locations but not the resolved types, generic substitutions, or
+  // refactoring availability this request must report, and the doc tables
+  // require loading the module anyway. The AST cache below (TryExistingAST)
+  // is the intended fast path: repeated queries against an unchanged
+  // invocation reuse the typechecked AST instead of rebuilding it.
   resolveCursor(*this, InputFile, Offset, Length, Actionables, SymbolGraph,
                 Invok, /*TryExistingAST=*/true, CancelOnSubsequentRequest,
                 fileSystem, CancellationToken, Receiver);
@@ -116,6 +116,11 @@ void swiftscan_scanner_cache_reset(swiftscan_scanner_t scanner) {
   ScanningTool->resetCache();
 }
 
+void swiftscan_scanner_cache_garbage_collect(swiftscan_scanner_t scanner) {
+  DependencyScanningTool *ScanningTool = unwrap(scanner);
+  ScanningTool->garbageCollectCache();
+}
+
 //=== Scanner Functions ---------------------------------------------------===//
 
 swiftscan_scanner_t swiftscan_scanner_create(void) {
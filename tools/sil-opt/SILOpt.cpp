@@ -386,7 +386,11 @@ EmitVerboseSIL("emit-verbose-sil",
                llvm::cl::desc("Emit locations during sil emission."));
 
 static llvm::cl::opt<bool>
-EmitSIB("emit-sib", llvm::cl::desc("Emit serialized AST + SIL file(s)"));
+EmitSIB("emit-sib",
+        llvm::cl::desc("Emit serialized AST + SIL file(s). The output can be "
+                       "fed back to sil-opt as input, skipping the SIL "
+                       "parser, which makes this the fast interchange format "
+                       "for chained sil-opt invocations."));
 
 static llvm::cl::opt<bool>
 Serialize("serialize", llvm::cl::desc("Emit serialized AST + SIL file(s)"));
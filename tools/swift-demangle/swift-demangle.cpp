@@ -351,6 +351,12 @@ static bool findMaybeMangled(llvm::StringRef input, llvm::StringRef &match) {
 }
 
 static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
+  // This tool doesn't print anything through stdio, so unsynchronize the
+  // C++ streams to keep getline from locking stdio on every read. The
+  // demangler context is shared across the whole stream; clearing it after
+  // each symbol recycles its arena rather than freeing it.
+  std::ios::sync_with_stdio(false);
+
   swift::Demangle::Context DCtx;
   for (std::string mangled; std::getline(std::cin, mangled);) {
     llvm::StringRef inputContents(mangled);
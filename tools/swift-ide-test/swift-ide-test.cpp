@@ -83,6 +83,7 @@ enum class ActionType {
   None,
   BatchCodeCompletion,
   CodeCompletion,
+  CodeCompletionReplay,
   REPLCodeCompletion,
   DumpCompletionCache,
   DumpImporterLookupTable,
@@ -170,6 +171,10 @@ Action(llvm::cl::desc("Mode:"), llvm::cl::init(ActionType::None),
                       "batch-code-completion", "Perform code completion in batch mode"),
            clEnumValN(ActionType::CodeCompletion,
                       "code-completion", "Perform code completion"),
+           clEnumValN(ActionType::CodeCompletionReplay,
+                      "code-completion-replay",
+                      "Replay a recorded completion session and report "
+                      "per-request latencies"),
            clEnumValN(ActionType::REPLCodeCompletion,
                       "repl-code-completion", "Perform REPL-style code completion"),
            clEnumValN(ActionType::DumpCompletionCache,
@@ -1702,6 +1707,144 @@ static int doBatchCodeCompletion(const CompilerInvocation &InitInvok,
   return 1;
 }
 
+/// Replay a recorded completion session and report per-request latencies.
+///
+/// The session file names one request per line, in the order they were
+/// recorded: '<snapshot-file> <token-name>', where the snapshot is the
+/// document content after the edits leading up to the request (resolved
+/// relative to the session file) and the token marks the request's position.
+/// Lines starting with '#' are comments. All requests run against a single
+/// \c CompletionInstance, so consecutive in-function-body requests exercise
+/// the ASTContext reuse fast path the same way SourceKit does.
+static int doCodeCompletionReplay(const CompilerInvocation &InitInvok,
+                                  StringRef SessionFilename) {
+  std::unique_ptr<llvm::MemoryBuffer> SessionBuf;
+  if (setBufferForFile(SessionFilename, SessionBuf))
+    return 1;
+
+  struct ReplayRequest {
+    std::string SnapshotFile;
+    std::string TokenName;
+  };
+  std::vector<ReplayRequest> Requests;
+  SmallVector<StringRef, 32> Lines;
+  SessionBuf->getBuffer().split(Lines, '\n');
+  for (StringRef Line : Lines) {
+    Line = Line.trim();
+    if (Line.empty() || Line.startswith("#"))
+      continue;
+    auto Split = Line.rsplit(' ');
+    if (Split.second.empty()) {
+      llvm::errs() << "error: malformed session line '" << Line
+                   << "'; expected '<snapshot-file> <token-name>'\n";
+      return 1;
+    }
+    SmallString<128> Path = Split.first.trim();
+    if (!llvm::sys::path::is_absolute(Path)) {
+      Path = llvm::sys::path::parent_path(SessionFilename);
+      llvm::sys::path::append(Path, Split.first.trim());
+    }
+    Requests.push_back({Path.str().str(), Split.second.trim().str()});
+  }
+  if (Requests.empty()) {
+    llvm::errs() << "error: no requests in session file '" << SessionFilename
+                 << "'\n";
+    return 1;
+  }
+
+  CompilerInvocation Invocation(InitInvok);
+  auto FileSystem = llvm::vfs::getRealFileSystem();
+  CompletionInstance CompletionInst;
+  ide::CodeCompletionCache CompletionCache;
+
+  // The snapshots are versions of one logical document, so present them to
+  // the compiler under a single buffer identifier; with varying identifiers
+  // the cached CompilerInstance could never be reused.
+  std::string BufferIdentifier = Requests.front().SnapshotFile;
+
+  std::vector<uint64_t> LatenciesUsec;
+  unsigned NumFailed = 0;
+  for (unsigned i = 0, e = Requests.size(); i != e; ++i) {
+    const auto &Request = Requests[i];
+    std::unique_ptr<llvm::MemoryBuffer> SnapshotBuf;
+    if (setBufferForFile(Request.SnapshotFile, SnapshotBuf))
+      return 1;
+    unsigned Offset;
+    std::string CleanSource = ide::removeCodeCompletionTokens(
+        SnapshotBuf->getBuffer(), Request.TokenName, &Offset);
+    if (Offset == ~0U) {
+      llvm::errs() << "error: could not find code completion token \""
+                   << Request.TokenName << "\" in '" << Request.SnapshotFile
+                   << "'\n";
+      return 1;
+    }
+    auto CleanFile = llvm::MemoryBuffer::getMemBufferCopy(CleanSource,
+                                                          BufferIdentifier);
+    auto CompletionBuf = ide::makeCodeCompletionMemoryBuffer(
+        CleanFile.get(), Offset, BufferIdentifier);
+
+    // Each request gets a fresh context, like in SourceKit; only the result
+    // cache and the CompletionInstance carry over.
+    ide::CodeCompletionContext CompletionContext(CompletionCache);
+    bool ReusedASTContext = false;
+    size_t NumResults = 0;
+    std::string CompletionError;
+    auto StartTime = std::chrono::high_resolution_clock::now();
+    CompletionInst.codeComplete(
+        Invocation, /*Args=*/{}, FileSystem, CompletionBuf.get(), Offset,
+        /*DiagC=*/nullptr, CompletionContext, /*CancellationFlag=*/nullptr,
+        [&](CancellableResult<CodeCompleteResult> Result) {
+          switch (Result.getKind()) {
+          case CancellableResultKind::Success:
+            ReusedASTContext =
+                Result->Info.completionContext->ReusingASTContext;
+            NumResults = Result->ResultSink.Results.size();
+            break;
+          case CancellableResultKind::Failure:
+            CompletionError = Result.getError();
+            break;
+          case CancellableResultKind::Cancelled:
+            CompletionError = "request cancelled";
+            break;
+          }
+        });
+    auto Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - StartTime);
+
+    if (!CompletionError.empty()) {
+      llvm::errs() << "error: request " << i << " (token \""
+                   << Request.TokenName << "\") failed: " << CompletionError
+                   << "\n";
+      ++NumFailed;
+      continue;
+    }
+    LatenciesUsec.push_back(Elapsed.count());
+    llvm::outs() << "Request " << i << ": token=" << Request.TokenName
+                 << "; results=" << NumResults
+                 << "; elapsed=" << Elapsed.count() << " usec";
+    if (ReusedASTContext)
+      llvm::outs() << " (reusing ASTContext)";
+    llvm::outs() << "\n";
+  }
+
+  if (!LatenciesUsec.empty()) {
+    llvm::sort(LatenciesUsec);
+    auto Percentile = [&](unsigned P) {
+      return LatenciesUsec[(LatenciesUsec.size() - 1) * P / 100];
+    };
+    uint64_t Total = 0;
+    for (uint64_t Latency : LatenciesUsec)
+      Total += Latency;
+    llvm::outs() << "Replay summary: requests=" << Requests.size()
+                 << "; failed=" << NumFailed
+                 << "; min=" << LatenciesUsec.front()
+                 << "; p50=" << Percentile(50) << "; p90=" << Percentile(90)
+                 << "; max=" << LatenciesUsec.back()
+                 << "; mean=" << Total / LatenciesUsec.size() << " (usec)\n";
+  }
+  return NumFailed ? 1 : 0;
+}
+
 static int doREPLCodeCompletion(const CompilerInvocation &InitInvok,
                                 StringRef SourceFilename) {
   std::unique_ptr<llvm::MemoryBuffer> FileBuf;
@@ -4551,6 +4694,10 @@ int main(int argc, char *argv[]) {
         options::CodeCompletionSourceText);
     break;
 
+  case ActionType::CodeCompletionReplay:
+    ExitCode = doCodeCompletionReplay(InitInvok, options::SourceFilename);
+    break;
+
   case ActionType::REPLCodeCompletion:
     ExitCode = doREPLCodeCompletion(InitInvok, options::SourceFilename);
     break;
@@ -23,8 +23,30 @@ internal struct DumpRawMetadata: ParsableCommand {
   @OptionGroup()
   var backtraceOptions: BacktraceOptions
 
+  @Flag(help: ArgumentHelp(
+      "Print one line per allocation tag instead of one per allocation",
+      discussion: "Aggregates the allocation count and total size for each " +
+                  "tag. Suitable for periodic snapshots of long-running " +
+                  "processes; combine with --fork-corpse to let the target " +
+                  "resume while the summary is computed."))
+  var summary: Bool = false
+
   func run() throws {
     try inspect(options: options) { process in
+      if summary {
+        var counts: [swift_metadata_allocation_tag_t: Int] = [:]
+        var sizes: [swift_metadata_allocation_tag_t: Int] = [:]
+        try process.context.allocations.forEach { allocation in
+          counts[allocation.tag, default: 0] += 1
+          sizes[allocation.tag, default: 0] += allocation.size
+        }
+        for tag in counts.keys.sorted() {
+          let name: String = process.context.name(allocation: tag) ?? "<unknown>"
+          print("Tag: \(tag) (\(name)) count: \(counts[tag]!) total size: \(sizes[tag]!)")
+        }
+        return
+      }
+
       let stacks: [swift_reflection_ptr_t:[swift_reflection_ptr_t]]? =
           backtraceOptions.style == nil
               ? nil
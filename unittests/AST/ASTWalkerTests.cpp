@@ -0,0 +1,204 @@
+//===--- ASTWalkerTests.cpp - Tests for MultiplexingASTWalker -------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+#include "TestContext.h"
+#include "swift/AST/ASTWalker.h"
+#include "swift/AST/Expr.h"
+#include "gtest/gtest.h"
+
+using namespace swift;
+using namespace swift::unittest;
+
+namespace {
+
+/// A visitation event: '<' for a pre-visit, '>' for a post-visit.
+using Event = std::pair<char, Expr *>;
+
+Event pre(Expr *E) { return {'<', E}; }
+Event post(Expr *E) { return {'>', E}; }
+
+/// Records every expression visit, optionally answering SkipChildren or Stop
+/// when it reaches a designated node.
+class RecordingWalker : public ASTWalker {
+public:
+  enum class Response { Continue, SkipChildren, Stop };
+
+  std::vector<Event> Events;
+
+  /// When the walker pre-visits (or, for \c TriggerInPost, post-visits) this
+  /// node, answer \c TriggerResponse instead of continuing.
+  Expr *TriggerNode = nullptr;
+  bool TriggerInPost = false;
+  Response TriggerResponse = Response::Continue;
+
+  PreWalkResult<Expr *> walkToExprPre(Expr *E) override {
+    Events.push_back(pre(E));
+    if (E == TriggerNode && !TriggerInPost) {
+      if (TriggerResponse == Response::SkipChildren)
+        return Action::SkipChildren(E);
+      if (TriggerResponse == Response::Stop)
+        return Action::Stop();
+    }
+    return Action::Continue(E);
+  }
+
+  PostWalkResult<Expr *> walkToExprPost(Expr *E) override {
+    Events.push_back(post(E));
+    if (E == TriggerNode && TriggerInPost &&
+        TriggerResponse == Response::Stop)
+      return Action::Stop();
+    return Action::Continue(E);
+  }
+};
+
+/// A two-level expression tree: a tuple of two parenthesized literals.
+struct WalkTestTree {
+  TestContext C;
+  IntegerLiteralExpr *Lit1, *Lit2;
+  ParenExpr *Paren1, *Paren2;
+  TupleExpr *Root;
+
+  WalkTestTree() {
+    Lit1 = IntegerLiteralExpr::createFromUnsigned(C.Ctx, 1);
+    Lit2 = IntegerLiteralExpr::createFromUnsigned(C.Ctx, 2);
+    Paren1 = new (C.Ctx) ParenExpr(SourceLoc(), Lit1, SourceLoc());
+    Paren2 = new (C.Ctx) ParenExpr(SourceLoc(), Lit2, SourceLoc());
+    Expr *elements[] = {Paren1, Paren2};
+    Root = TupleExpr::createImplicit(C.Ctx, elements, /*ElementNames*/ {});
+  }
+
+  std::vector<Event> fullTraversal() const {
+    return {pre(Root),   pre(Paren1), pre(Lit1),  post(Lit1), post(Paren1),
+            pre(Paren2), pre(Lit2),   post(Lit2), post(Paren2), post(Root)};
+  }
+};
+
+} // end anonymous namespace
+
+TEST(MultiplexingASTWalker, DeliversFullTraversalToAllClients) {
+  WalkTestTree tree;
+  RecordingWalker solo;
+  EXPECT_EQ(tree.Root, tree.Root->walk(solo));
+
+  RecordingWalker a, b;
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+  EXPECT_EQ(tree.Root, tree.Root->walk(mux));
+
+  // Every client sees exactly the sequence a solo walk sees.
+  EXPECT_EQ(tree.fullTraversal(), solo.Events);
+  EXPECT_EQ(solo.Events, a.Events);
+  EXPECT_EQ(solo.Events, b.Events);
+}
+
+TEST(MultiplexingASTWalker, SkipChildrenSuppressesOnlyThatSubtree) {
+  WalkTestTree tree;
+  RecordingWalker a, b;
+  a.TriggerNode = tree.Paren1;
+  a.TriggerResponse = RecordingWalker::Response::SkipChildren;
+
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+  EXPECT_EQ(tree.Root, tree.Root->walk(mux));
+
+  // The skipping client misses the subtree's contents and the skipped node's
+  // own post-visit, then resumes at the next sibling.
+  std::vector<Event> expectedA = {pre(tree.Root),   pre(tree.Paren1),
+                                  pre(tree.Paren2), pre(tree.Lit2),
+                                  post(tree.Lit2),  post(tree.Paren2),
+                                  post(tree.Root)};
+  EXPECT_EQ(expectedA, a.Events);
+
+  // The other client is unaffected.
+  EXPECT_EQ(tree.fullTraversal(), b.Events);
+}
+
+TEST(MultiplexingASTWalker, SkipChildrenReactivatesAtPostVisitAboveSkip) {
+  WalkTestTree tree;
+  RecordingWalker a, b;
+  a.TriggerNode = tree.Paren2;
+  a.TriggerResponse = RecordingWalker::Response::SkipChildren;
+
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+  EXPECT_EQ(tree.Root, tree.Root->walk(mux));
+
+  // Skipping the last child: there is no next sibling, so the client is
+  // reactivated by the parent's post-visit.
+  std::vector<Event> expectedA = {pre(tree.Root),   pre(tree.Paren1),
+                                  pre(tree.Lit1),   post(tree.Lit1),
+                                  post(tree.Paren1), pre(tree.Paren2),
+                                  post(tree.Root)};
+  EXPECT_EQ(expectedA, a.Events);
+  EXPECT_EQ(tree.fullTraversal(), b.Events);
+}
+
+TEST(MultiplexingASTWalker, SkipsSubtreeOnceAllClientsSkip) {
+  WalkTestTree tree;
+  RecordingWalker a, b;
+  for (auto *walker : {&a, &b}) {
+    walker->TriggerNode = tree.Paren1;
+    walker->TriggerResponse = RecordingWalker::Response::SkipChildren;
+  }
+
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+  EXPECT_EQ(tree.Root, tree.Root->walk(mux));
+
+  // With no client interested in Paren1's subtree, the shared traversal skips
+  // it outright; per SkipChildren semantics its post-visit never happens.
+  std::vector<Event> expected = {pre(tree.Root),   pre(tree.Paren1),
+                                 pre(tree.Paren2), pre(tree.Lit2),
+                                 post(tree.Lit2),  post(tree.Paren2),
+                                 post(tree.Root)};
+  EXPECT_EQ(expected, a.Events);
+  EXPECT_EQ(expected, b.Events);
+}
+
+TEST(MultiplexingASTWalker, StoppedClientStopsReceivingCallbacks) {
+  WalkTestTree tree;
+  RecordingWalker a, b;
+  a.TriggerNode = tree.Paren1;
+  a.TriggerResponse = RecordingWalker::Response::Stop;
+
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+
+  // One client stopping does not terminate the shared walk.
+  EXPECT_EQ(tree.Root, tree.Root->walk(mux));
+
+  std::vector<Event> expectedA = {pre(tree.Root), pre(tree.Paren1)};
+  EXPECT_EQ(expectedA, a.Events);
+  EXPECT_EQ(tree.fullTraversal(), b.Events);
+}
+
+TEST(MultiplexingASTWalker, StopsTraversalOnceAllClientsStop) {
+  WalkTestTree tree;
+  RecordingWalker a, b;
+  a.TriggerNode = tree.Paren1;
+  a.TriggerResponse = RecordingWalker::Response::Stop;
+  b.TriggerNode = tree.Lit1;
+  b.TriggerInPost = true;
+  b.TriggerResponse = RecordingWalker::Response::Stop;
+
+  ASTWalker *clients[] = {&a, &b};
+  MultiplexingASTWalker mux(clients);
+
+  // Once the last client stops, the shared traversal terminates early.
+  EXPECT_EQ(nullptr, tree.Root->walk(mux));
+
+  std::vector<Event> expectedA = {pre(tree.Root), pre(tree.Paren1)};
+  EXPECT_EQ(expectedA, a.Events);
+  std::vector<Event> expectedB = {pre(tree.Root), pre(tree.Paren1),
+                                  pre(tree.Lit1), post(tree.Lit1)};
+  EXPECT_EQ(expectedB, b.Events);
+}
@@ -0,0 +1,233 @@
+//===--- RuntimeEntryPoints.cpp - Runtime entry point microbenchmarks -----===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Microbenchmarks for the hot runtime entry points, calling them directly
+// against the statically linked runtime with controlled cache states (cold,
+// warm and contended). These don't assert on timings -- machines differ too
+// much for that -- they print ns/op so that runtime changes have canonical
+// numbers to compare against, while the EXPECTs keep the measured calls
+// honest.
+//
+//===----------------------------------------------------------------------===//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "swift/Runtime/Casting.h"
+#include "swift/Runtime/HeapObject.h"
+#include "swift/Runtime/Metadata.h"
+#include "gtest/gtest.h"
+
+#include "../ThreadingHelpers.h"
+
+using namespace swift;
+
+//===----------------------------------------------------------------------===//
+// Measurement helpers
+//===----------------------------------------------------------------------===//
+
+/// Run `body(i)` for `iterations` and return the average time per call in
+/// nanoseconds.
+template <typename Body>
+static double measure(size_t iterations, Body &&body) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+    body(i);
+  auto end = std::chrono::steady_clock::now();
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  return double(ns) / double(iterations);
+}
+
+static void report(const char *entryPoint, const char *cacheState,
+                   double nsPerOp) {
+  printf("  %-32s %-10s %10.1f ns/op\n", entryPoint, cacheState, nsPerOp);
+}
+
+//===----------------------------------------------------------------------===//
+// Test object scaffolding (mirrors Refcounting.cpp)
+//===----------------------------------------------------------------------===//
+
+struct TestObject : HeapObject {
+  size_t *Addr;
+  size_t Value;
+};
+
+static SWIFT_CC(swift) void destroyTestObject(SWIFT_CONTEXT HeapObject *_object) {
+  auto object = static_cast<TestObject*>(_object);
+  assert(object->Addr && "object already deallocated");
+  *object->Addr = object->Value;
+  object->Addr = nullptr;
+  swift_deallocObject(object, sizeof(TestObject), alignof(TestObject) - 1);
+}
+
+static const FullMetadata<ClassMetadata> TestClassObjectMetadata = {
+  { { &destroyTestObject }, { &VALUE_WITNESS_SYM(Bo) } },
+  { { nullptr }, ClassFlags::UsesSwiftRefcounting, 0, 0, 0, 0, 0, 0 }
+};
+
+static TestObject *allocTestObject(size_t *addr, size_t value) {
+  auto result =
+    static_cast<TestObject *>(swift_allocObject(&TestClassObjectMetadata,
+                                                sizeof(TestObject),
+                                                alignof(TestObject) - 1));
+  result->Addr = addr;
+  result->Value = value;
+  return result;
+}
+
+//===----------------------------------------------------------------------===//
+// swift_retain / swift_release
+//===----------------------------------------------------------------------===//
+
+TEST(RuntimeEntryPointBenchmark, RetainRelease) {
+  const size_t iterations = 10'000'000;
+  size_t deallocated = 0;
+  auto object = allocTestObject(&deallocated, 1);
+
+  // Uncontended retain/release pairs on an object with an inline refcount.
+  auto warm = measure(iterations, [&](size_t) {
+    swift_retain(object);
+    swift_release(object);
+  });
+  report("swift_retain/swift_release", "warm", warm);
+
+  // All threads hammer the refcount word of a single shared object,
+  // maximizing contention on the atomic RMW.
+  const int threadCount = 4;
+  const size_t perThread = iterations / threadCount;
+  auto start = std::chrono::steady_clock::now();
+  threadedExecute(threadCount, [&](int) {
+    for (size_t i = 0; i < perThread; ++i) {
+      swift_retain(object);
+      swift_release(object);
+    }
+  }, [] {});
+  auto end = std::chrono::steady_clock::now();
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  report("swift_retain/swift_release", "contended",
+         double(ns) / double(perThread * threadCount));
+
+  EXPECT_EQ(0u, deallocated);
+  swift_release(object);
+  EXPECT_EQ(1u, deallocated);
+}
+
+//===----------------------------------------------------------------------===//
+// Metadata instantiation cache
+//===----------------------------------------------------------------------===//
+
+// Fabricating a complete generic type descriptor for swift_getGenericMetadata
+// in a host unittest is fragile, so these exercise the same MetadataCache
+// machinery through the tuple entry point: a miss allocates and initializes
+// new metadata, a hit is a cache lookup keyed on the element metadata.
+
+TEST(RuntimeEntryPointBenchmark, MetadataCache) {
+  auto request = MetadataRequest(MetadataState::Complete);
+  const Metadata *element = &TestClassObjectMetadata;
+
+  // Every query nests the previous result, so each call inserts a new
+  // entry: this measures the miss (instantiation) path.
+  const Metadata *chain = element;
+  auto cold = measure(10'000, [&](size_t) {
+    auto response =
+        swift_getTupleTypeMetadata2(request, chain, element,
+                                    /*labels=*/nullptr,
+                                    /*proposedWitnesses=*/nullptr);
+    EXPECT_EQ(MetadataState::Complete, response.State);
+    chain = response.Value;
+  });
+  report("swift_getTupleTypeMetadata2", "cold", cold);
+
+  // Repeated queries for the same key only hit the cache.
+  auto cached = swift_getTupleTypeMetadata2(request, element, element, nullptr,
+                                            nullptr).Value;
+  auto warm = measure(1'000'000, [&](size_t) {
+    auto response =
+        swift_getTupleTypeMetadata2(request, element, element, nullptr,
+                                    nullptr);
+    EXPECT_EQ(cached, response.Value);
+  });
+  report("swift_getTupleTypeMetadata2", "warm", warm);
+
+  // All threads look up the same (already instantiated) key; the cache
+  // readers should scale, so this mostly measures cache-line sharing.
+  const int threadCount = 4;
+  const size_t perThread = 1'000'000;
+  auto start = std::chrono::steady_clock::now();
+  threadedExecute(threadCount, [&](int) {
+    for (size_t i = 0; i < perThread; ++i) {
+      auto response =
+          swift_getTupleTypeMetadata2(request, element, element, nullptr,
+                                      nullptr);
+      EXPECT_EQ(cached, response.Value);
+    }
+  }, [] {});
+  auto end = std::chrono::steady_clock::now();
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  report("swift_getTupleTypeMetadata2", "contended",
+         double(ns) / double(perThread * threadCount));
+}
+
+//===----------------------------------------------------------------------===//
+// swift_conformsToProtocol
+//===----------------------------------------------------------------------===//
+
+static ProtocolDescriptor BenchmarkProtocol{
+  "_TMp17RuntimeEntryPoint17BenchmarkProtocol",
+  nullptr,
+  ProtocolDescriptorFlags()
+    .withSwift(true)
+    .withClassConstraint(ProtocolClassConstraint::Any)
+    .withDispatchStrategy(ProtocolDispatchStrategy::Swift)
+};
+
+TEST(RuntimeEntryPointBenchmark, ConformsToProtocol) {
+  const Metadata *type = &TestClassObjectMetadata;
+
+  // The first query scans the registered conformance records and caches the
+  // (negative) result; there is no way to register a conformance for our
+  // fabricated protocol from a host unittest, so both states measure the
+  // negative lookup.
+  auto cold = measure(1, [&](size_t) {
+    EXPECT_EQ(nullptr, swift_conformsToProtocol(type, &BenchmarkProtocol));
+  });
+  report("swift_conformsToProtocol", "cold", cold);
+
+  auto warm = measure(1'000'000, [&](size_t) {
+    EXPECT_EQ(nullptr, swift_conformsToProtocol(type, &BenchmarkProtocol));
+  });
+  report("swift_conformsToProtocol", "warm", warm);
+}
+
+//===----------------------------------------------------------------------===//
+// swift_dynamicCastClass
+//===----------------------------------------------------------------------===//
+
+TEST(RuntimeEntryPointBenchmark, DynamicCastClass) {
+  size_t deallocated = 0;
+  auto object = allocTestObject(&deallocated, 1);
+
+  // Exact-match class cast; the isa check succeeds immediately.
+  auto warm = measure(10'000'000, [&](size_t) {
+    EXPECT_EQ(object, swift_dynamicCastClass(object,
+                                             &TestClassObjectMetadata));
+  });
+  report("swift_dynamicCastClass", "warm", warm);
+
+  swift_release(object);
+  EXPECT_EQ(1u, deallocated);
+}
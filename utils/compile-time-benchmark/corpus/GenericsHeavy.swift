@@ -0,0 +1,81 @@
+//===--- GenericsHeavy.swift ----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+// Generics workload: nested generic types, associated-type requirements,
+// conditional conformances, and deep concrete instantiations that exercise
+// generic signature construction, requirement machinery, and specialization.
+//===----------------------------------------------------------------------===//
+
+public protocol Shape {
+  associatedtype Area: Numeric
+  func area() -> Area
+}
+
+public protocol Container {
+  associatedtype Element
+  var contents: [Element] { get }
+  func combined<C: Container>(with other: C) -> Int where C.Element == Element
+}
+
+public struct Boxed<T>: Container {
+  public var contents: [T]
+  public func combined<C: Container>(with other: C) -> Int
+      where C.Element == T {
+    return contents.count + other.contents.count
+  }
+}
+
+public struct Pair<A, B> {
+  public var first: A
+  public var second: B
+}
+
+extension Pair: Shape where A: Shape, B: Shape, A.Area == B.Area {
+  public func area() -> A.Area {
+    return first.area() + second.area()
+  }
+}
+
+public struct Square: Shape {
+  public var side: Int
+  public func area() -> Int { return side * side }
+}
+
+public struct Rect: Shape {
+  public var w: Int
+  public var h: Int
+  public func area() -> Int { return w * h }
+}
+
+public func totalArea<S: Sequence>(_ shapes: S) -> Int
+    where S.Element: Shape, S.Element.Area == Int {
+  return shapes.reduce(0) { $0 + $1.area() }
+}
+
+public func nest<T: Shape>(_ t: T) -> Pair<Pair<T, T>, Pair<T, T>>
+    where T.Area == Int {
+  return Pair(first: Pair(first: t, second: t),
+              second: Pair(first: t, second: t))
+}
+
+public func genericsHeavy() -> Int {
+  let s = Square(side: 3)
+  let r = Rect(w: 2, h: 5)
+  let n1 = nest(s)
+  let n2 = nest(nest(r))
+  let n3 = nest(nest(nest(s)))
+  let areas = n1.area() + n2.area() + n3.area()
+  let boxed = Boxed(contents: [s, s, s])
+  let more = Boxed(contents: [Square(side: 1)])
+  let counts = boxed.combined(with: more)
+  let mixed = totalArea([Pair(first: s, second: s),
+                         Pair(first: Square(side: 2), second: s)])
+  return areas + counts + mixed
+}
@@ -0,0 +1,99 @@
+//===--- LargeFunction.swift ----------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+// Large-function workload: a single function with many statements, branches,
+// and local mutations, producing a big SIL body for the mandatory passes, the
+// optimizer's intra-function analyses, and IRGen to chew on.
+//===----------------------------------------------------------------------===//
+
+public enum Opcode {
+  case add(Int)
+  case sub(Int)
+  case mul(Int)
+  case jump(Int)
+  case halt
+}
+
+public func largeInterpreterStep(_ program: [Opcode], fuel: Int) -> Int {
+  var acc = 0
+  var pc = 0
+  var remaining = fuel
+  var history: [Int] = []
+  var evenCount = 0
+  var oddCount = 0
+  var maxAcc = Int.min
+  var minAcc = Int.max
+
+  while remaining > 0 && pc >= 0 && pc < program.count {
+    remaining -= 1
+    switch program[pc] {
+    case .add(let v):
+      acc &+= v
+      pc += 1
+    case .sub(let v):
+      acc &-= v
+      pc += 1
+    case .mul(let v):
+      acc &*= v
+      pc += 1
+    case .jump(let target):
+      pc = acc % 2 == 0 ? target : pc + 1
+    case .halt:
+      pc = program.count
+    }
+
+    history.append(acc)
+    if acc % 2 == 0 {
+      evenCount += 1
+    } else {
+      oddCount += 1
+    }
+    if acc > maxAcc { maxAcc = acc }
+    if acc < minAcc { minAcc = acc }
+
+    if history.count > 64 {
+      history.removeFirst(32)
+    }
+
+    if acc > 1_000_000 {
+      acc /= 2
+    } else if acc < -1_000_000 {
+      acc = -acc / 2
+    }
+
+    if remaining % 128 == 0 {
+      var checksum = 0
+      for (i, h) in history.enumerated() {
+        checksum &+= h &* (i + 1)
+        if checksum % 7 == 0 {
+          checksum &+= evenCount
+        } else if checksum % 5 == 0 {
+          checksum &-= oddCount
+        } else if checksum % 3 == 0 {
+          checksum ^= acc
+        }
+      }
+      acc &+= checksum % 97
+    }
+
+    if evenCount > 0 && oddCount > 0 && evenCount % oddCount == 0 {
+      acc &+= evenCount / oddCount
+    }
+    if maxAcc != Int.min && minAcc != Int.max {
+      let spread = maxAcc &- minAcc
+      if spread > 0 && acc % spread == 1 {
+        acc &-= spread
+      }
+    }
+  }
+
+  let summary = history.reduce(0, &+) &+ evenCount &- oddCount
+  return acc &+ summary
+}
@@ -0,0 +1,60 @@
+//===--- SolverHeavy.swift ------------------------------------------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2022 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+//
+//===----------------------------------------------------------------------===//
+// Constraint-solver workload: overloaded operators, literals that need
+// defaulting, and closures whose parameter types must be inferred. Expressions
+// are kept just below the solver's complexity limits; the point is sustained
+// solving, not the too-complex diagnostic.
+//===----------------------------------------------------------------------===//
+
+struct V2 {
+  var x: Double
+  var y: Double
+}
+
+func + (a: V2, b: V2) -> V2 { return V2(x: a.x + b.x, y: a.y + b.y) }
+func - (a: V2, b: V2) -> V2 { return V2(x: a.x - b.x, y: a.y - b.y) }
+func * (a: V2, b: Double) -> V2 { return V2(x: a.x * b, y: a.y * b) }
+func * (a: Double, b: V2) -> V2 { return b * a }
+func .. (a: V2, b: V2) -> Double { return a.x * b.x + a.y * b.y }
+infix operator ..: MultiplicationPrecedence
+
+func mix(_ a: V2, _ b: V2, _ t: Double) -> V2 {
+  return a * (1.0 - t) + b * t
+}
+
+public func solverHeavyVectors() -> Double {
+  let a = V2(x: 1, y: 2)
+  let b = V2(x: 3, y: 4)
+  let c = mix(a * 2.0 + b * 0.5 - a, b - 2.0 * a + b * 0.25, 0.5)
+  let d = mix(c + a * 0.125 - b, a - c * 3.0 + b * 0.75, 0.25)
+  let e = (a + b * 2.0 - c) .. (d - a * 0.5 + b)
+  let f = (c - d + a * 1.5) .. (b + d * 0.25 - c)
+  let g = mix(c, d, e / (f + 1.0)) .. mix(d, a, f / (e + 1.0))
+  return e + f + g
+}
+
+public func solverHeavyClosures() -> Int {
+  let xs = [1, 2, 3, 4, 5, 6, 7, 8]
+  let r1 = xs.map { $0 * 2 }.filter { $0 % 3 != 0 }.reduce(0, +)
+  let r2 = xs.map { $0 + 1 }.map { $0 * $0 }.filter { $0 < 50 }.reduce(1, *)
+  let r3 = zip(xs, xs.reversed()).map { $0 + $1 }.reduce(0) { $0 &+ $1 }
+  let r4 = xs.sorted { ($0 % 3, $0) < ($1 % 3, $1) }.prefix(4).reduce(0, +)
+  let r5 = xs.compactMap { $0 % 2 == 0 ? $0 / 2 : nil }.reduce(0, +)
+  return r1 + r2 + r3 + r4 + r5
+}
+
+public func solverHeavyLiterals() -> Double {
+  let t1 = 1 + 2.5 * 3 - 4 / 8 + 16 * 0.25
+  let t2 = (1 + 2) * (3.5 - 4) + (5 / 2) * (6 - 0.5)
+  let t3 = t1 * 2 + t2 / 4 - 1 + 0.125 * (t1 - t2)
+  let t4: Double = 3 * 7 + 2
+  return t1 + t2 + t3 + t4
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#
+# This source file is part of the Swift.org open source project
+#
+# Copyright (c) 2022 Apple Inc. and the Swift project authors
+# Licensed under Apache License v2.0 with Runtime Library Exception
+#
+# See https://swift.org/LICENSE.txt for license information
+#
+# Compiles the compile-time corpus through swift-frontend with
+# -stats-output-dir and either records a per-phase baseline or compares the
+# merged stats of this run against one. Baseline format and regression
+# thresholds are owned by utils/process-stats-dir.py; this script only drives
+# the compilations and delegates the analysis.
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+UTILS_DIR = os.path.dirname(os.path.abspath(__file__))
+CORPUS_DIR = os.path.join(UTILS_DIR, 'corpus')
+PROCESS_STATS = os.path.join(os.path.dirname(UTILS_DIR),
+                             'process-stats-dir.py')
+
+
+def compile_corpus(args, stats_dir):
+    sources = sorted(s for s in os.listdir(CORPUS_DIR)
+                     if s.endswith('.swift'))
+    if not sources:
+        sys.exit("no corpus sources found in " + CORPUS_DIR)
+    for iteration in range(args.iterations):
+        for source in sources:
+            module_name = os.path.splitext(source)[0]
+            output = os.path.join(args.scratch_dir,
+                                  "%s.%d.o" % (module_name, iteration))
+            command = [
+                args.swift_frontend, '-frontend', '-c',
+                os.path.join(CORPUS_DIR, source),
+                '-module-name', module_name,
+                '-stats-output-dir', stats_dir,
+                '-o', output,
+            ] + args.extra_frontend_args
+            if args.verbose:
+                print(' '.join(command))
+            subprocess.check_call(command)
+
+
+def process_stats(args, stats_dir):
+    command = [sys.executable, PROCESS_STATS,
+               '--delta-pct-thresh', str(args.delta_pct_thresh),
+               '--delta-usec-thresh', str(args.delta_usec_thresh)]
+    if args.select_stat:
+        command += ['--select-stat', args.select_stat]
+    if args.set_baseline:
+        command += ['--set-csv-baseline', args.baseline]
+    else:
+        if not os.path.exists(args.baseline):
+            sys.exit("no baseline at %s; record one with --set-baseline"
+                     % args.baseline)
+        command += ['--compare-to-csv-baseline', args.baseline]
+    command.append(stats_dir)
+    if args.verbose:
+        print(' '.join(command))
+    return subprocess.call(command)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--swift-frontend", required=True,
+                        help="Path to the swift-frontend to measure")
+    parser.add_argument("--baseline", required=True,
+                        help="Baseline CSV to record or compare against")
+    parser.add_argument("--set-baseline", action="store_true",
+                        help="Record this run as the baseline instead of "
+                             "comparing")
+    parser.add_argument("--iterations", type=int, default=3,
+                        help="Number of times to compile the corpus; stats "
+                             "of all iterations are merged")
+    parser.add_argument("--delta-pct-thresh", type=float, default=1.0,
+                        help="Percentage change regarded as a change")
+    parser.add_argument("--delta-usec-thresh", type=int, default=100000,
+                        help="Absolute timer change (usec) regarded as a "
+                             "change")
+    parser.add_argument("--select-stat", default='',
+                        help="Restrict analysis to stats matching this "
+                             "regex")
+    parser.add_argument("--verbose", action="store_true",
+                        help="Print the commands being run")
+    parser.add_argument("extra_frontend_args", nargs='*',
+                        help="Additional arguments passed to swift-frontend")
+    args = parser.parse_args()
+
+    args.scratch_dir = tempfile.mkdtemp(prefix='compile-time-benchmark-')
+    stats_dir = os.path.join(args.scratch_dir, 'stats')
+    os.mkdir(stats_dir)
+    try:
+        compile_corpus(args, stats_dir)
+        result = process_stats(args, stats_dir)
+    finally:
+        shutil.rmtree(args.scratch_dir, ignore_errors=True)
+    # process-stats-dir.py returns the number of regressions when comparing.
+    return result
+
+
+if __name__ == '__main__':
+    sys.exit(main())